@@ -40,13 +40,21 @@ public:
      * @param G The graph.
      * @param normalized If set to @c true the scores are normalized in the interval [0,1].
      * @param enforceBucketQueueAlgorithm If set to @c true, uses a bucket priority queue data structure. This it is generally slower than ParK but may be more flexible. TODO check
-     * @param storeNodeOrder If set to @c true, the order of the nodes in ascending order of the cores is stored and can later be returned using getNodeOrder(). Enforces the sequential bucket priority queue algorithm.
+     * @param storeNodeOrder If set to @c true, the order of the nodes in ascending order of the cores is stored and can later be returned using getNodeOrder(). The order is a degeneracy order: every node has at most its core number neighbors after it.
      *
      * The algorithm runs in parallel if the usage of a bucket priority queue is not enforced and
      * if the node ids of the input graph are continuous (i.e., numberOfNodes() = upperNodeIdBound()).
      */
     CoreDecomposition(const Graph& G, bool normalized=false, bool enforceBucketQueueAlgorithm = false, bool storeNodeOrder = false);
 
+    /**
+     * Only count the edges between nodes in the same subset of @a p, i.e., decompose the graph
+     * without the edges between different subsets, but without copying it. Call before run().
+     *
+     * @param p Partition of the nodes; must outlive the call of run().
+     */
+    void restrictToSubsets(const Partition &p) { subsets = &p; }
+
     /**
      * Perform k-core decomposition of graph passed in constructor.
      */
@@ -107,6 +115,14 @@ private:
 
     std::vector<node> nodeOrder; // Stores the node order, i.e., all nodes sorted by core number
 
+    const Partition *subsets = nullptr; // if set, only edges within subsets are counted
+
+    bool countsEdge(node u, node v) const {
+        return !subsets || subsets->inSameSubset(u, v);
+    }
+
+    count restrictedDegree(node u) const;
+
     /**
      * Perform k-core decomposition of graph passed in constructor.
      * ParK is an algorithm by Naga Shailaja Dasari, Ranjan Desh, and Zubair M.
@@ -8,6 +8,7 @@
 #ifndef NETWORKIT_COMPONENTS_BICONNECTED_COMPONENTS_HPP_
 #define NETWORKIT_COMPONENTS_BICONNECTED_COMPONENTS_HPP_
 
+#include <algorithm>
 #include <map>
 #include <unordered_set>
 #include <vector>
@@ -22,6 +23,10 @@ namespace NetworKit {
  * Determines the biconnected components of an undirected graph as defined in
  * Tarjan, Robert. Depth-First Search and Linear Graph Algorithms. SIAM J.
  * Comput. Vol 1, No. 2, June 1972.
+ *
+ * The components are computed by an iterative edge-stack depth-first search and stored
+ * in flat arrays: the nodes of all components one after another (CSR) and, per node, the
+ * components containing it. No per-node containers are allocated.
  */
 class BiconnectedComponents final : public Algorithm {
 
@@ -30,8 +35,10 @@ public:
      * Creates BiconnectedComponents class for Graph @a G.
      *
      * @param G The graph.
+     * @param parallel Search the connected components of @a G in parallel. The result is
+     * the same as of the sequential search, including the order of the components.
      */
-    BiconnectedComponents(const Graph &G);
+    BiconnectedComponents(const Graph &G, bool parallel = false);
 
     /*
      * This method determines the biconnected components for the graph given in
@@ -67,26 +74,83 @@ public:
      * @param u A node.
      * @return Components that contain node @a u.
      */
-    const std::unordered_set<node> &getComponentsOfNode(node u) const {
+    std::unordered_set<node> getComponentsOfNode(node u) const;
+
+    /*
+     * Contiguous, increasing range of the indices of the components containing a node.
+     */
+    class ComponentRange {
+        const index *first;
+        const index *last;
+
+    public:
+        ComponentRange(const index *first, const index *last) : first(first), last(last) {}
+
+        const index *begin() const noexcept { return first; }
+        const index *end() const noexcept { return last; }
+        count size() const noexcept { return static_cast<count>(last - first); }
+        bool contains(index c) const { return std::binary_search(first, last, c); }
+    };
+
+    /*
+     * Get the components that contain node @a u like getComponentsOfNode(), but as a view
+     * of the internal arrays, without allocating.
+     *
+     * @param u A node.
+     * @return Increasing indices of the components that contain node @a u.
+     */
+    ComponentRange componentRangeOfNode(node u) const {
+        assureFinished();
+        return ComponentRange(nodeComponents.data() + nodeComponentOffsets[u],
+                              nodeComponents.data() + nodeComponentOffsets[u + 1]);
+    }
+
+    /*
+     * Get the nodes of all components one after another: the nodes of component c are
+     * getComponentNodes()[getComponentOffsets()[c]] up to, but excluding,
+     * getComponentNodes()[getComponentOffsets()[c + 1]].
+     */
+    const std::vector<index> &getComponentOffsets() const {
         assureFinished();
-        return componentsOfNode[u];
+        return componentOffsets;
+    }
+
+    const std::vector<node> &getComponentNodes() const {
+        assureFinished();
+        return componentNodes;
+    }
+
+    /*
+     * Get the articulation points, i.e., the nodes that belong to more than one component,
+     * in increasing order.
+     */
+    const std::vector<node> &getArticulationPoints() const {
+        assureFinished();
+        return articulationPoints;
     }
 
 private:
+    // Per connected component, the state of the search and the components found in it
+    struct Search;
+
     void init();
-    void newComponent(std::pair<node, node> e);
+    void searchFrom(node root, Search &search);
+    void buildNodeComponents();
 
     const Graph *G;
-    count n;
-    count idx;
+    bool parallel;
     count nComp;
     std::vector<count> level;
     std::vector<count> lowpt;
     std::vector<node> parent;
-    std::vector<bool> visited;
-    std::vector<bool> isRoot;
-    std::vector<std::unordered_set<node>> componentsOfNode;
-    std::map<count, count> componentSizes;
+    // Per node, the search-local index of the last component it was added to
+    std::vector<index> lastComponent;
+
+    std::vector<index> componentOffsets;
+    std::vector<node> componentNodes;
+    std::vector<index> nodeComponentOffsets;
+    std::vector<index> nodeComponents;
+    std::vector<node> articulationPoints;
 };
 
 inline count BiconnectedComponents::numberOfComponents() {
@@ -96,21 +160,26 @@ inline count BiconnectedComponents::numberOfComponents() {
 
 inline std::map<count, count> BiconnectedComponents::getComponentSizes() {
     assureFinished();
+    std::map<count, count> componentSizes;
+    for (index c = 0; c < nComp; ++c)
+        componentSizes.emplace_hint(componentSizes.end(), c,
+                                    componentOffsets[c + 1] - componentOffsets[c]);
     return componentSizes;
 }
 
 inline std::vector<std::vector<node>> BiconnectedComponents::getComponents() {
     assureFinished();
     std::vector<std::vector<node>> result(nComp);
-
-    node v = 0;
-    for (auto components : componentsOfNode) {
-        for (auto it = components.begin(); it != components.end(); ++it) {
-            result[*it].push_back(v);
-        }
-        ++v;
-    }
+    for (index c = 0; c < nComp; ++c)
+        result[c].assign(componentNodes.begin() + componentOffsets[c],
+                         componentNodes.begin() + componentOffsets[c + 1]);
     return result;
 }
+
+inline std::unordered_set<node> BiconnectedComponents::getComponentsOfNode(node u) const {
+    assureFinished();
+    return {nodeComponents.begin() + nodeComponentOffsets[u],
+            nodeComponents.begin() + nodeComponentOffsets[u + 1]};
+}
 } // namespace NetworKit
 #endif // NETWORKIT_COMPONENTS_BICONNECTED_COMPONENTS_HPP_
@@ -0,0 +1,112 @@
+#ifndef NETWORKIT_CYCLES_BLOCKED_BFS_HPP_
+#define NETWORKIT_CYCLES_BLOCKED_BFS_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * Reusable breadth-first search on a graph without a set of blocked nodes, as needed by
+ * the chordless cycle enumerators. All arrays are allocated once and reused: visited
+ * nodes are stamped with the id of the current search, the queue is a flat array and
+ * every node stores a single parent. Blocked counters are read from the caller's vector.
+ * The cost of a search is thus proportional to the explored region only.
+ */
+class BlockedBFS final {
+
+public:
+    /**
+     * Create the search workspace for graphs with up to @a upperNodeIdBound nodes;
+     * it grows if it is used on a larger graph.
+     */
+    explicit BlockedBFS(count upperNodeIdBound = 0);
+
+    /**
+     * Breadth-first search in @a G from @a source, never visiting nodes @a v with
+     * blocked[v] > 0. If @a target is given, the search stops once it is dequeued.
+     *
+     * @param blocked Blocked counters per node or nullptr if no node is blocked.
+     * @param maxDistance Do not visit nodes farther than this from @a source.
+     * @return Whether @a target (if given) was reached.
+     */
+    bool run(const Graph &G, node source, const std::vector<count> *blocked = nullptr,
+             node target = none, count maxDistance = none);
+
+    /**
+     * Bidirectional breadth-first search between @a source and @a target in @a G, never
+     * visiting blocked nodes. As in BidirectionalBFS, the smaller of the two frontiers is
+     * expanded by one level at a time until the two balls meet; the path found is a
+     * shortest path, too. Typically explores much less of the graph than run(). Only the
+     * nodes of the ball around @a source and those on the path to @a target count as reached.
+     *
+     * @param blocked Blocked counters per node or nullptr if no node is blocked.
+     * @return Whether @a target was reached.
+     */
+    bool runBidirectional(const Graph &G, node source, node target,
+                          const std::vector<count> *blocked = nullptr);
+
+    /**
+     * @return Whether the last search reached @a u.
+     */
+    bool isReached(node u) const { return ts && u < timestamp.size() && timestamp[u] == ts; }
+
+    /**
+     * @return Distance of @a u from the source of the last search; @a u must be reached.
+     */
+    count getDistance(node u) const {
+        assert(isReached(u));
+        return distance[u];
+    }
+
+    /**
+     * Returns the path from the source of the last search to @a t and an empty path if
+     * @a t was not reached or is the source itself.
+     *
+     * @param forward If @c true (default) the path is directed from source to @a t,
+     * otherwise the path is reversed.
+     */
+    std::vector<node> getPath(node t, bool forward = true) const;
+
+    /**
+     * Iterate over the nodes reached by the last search in order of discovery.
+     */
+    template <typename L>
+    void forReachedNodes(L handle) const {
+        for (index i = 0; i < queueEnd; ++i)
+            handle(queue[i]);
+    }
+
+    /**
+     * @return Number of nodes reached by the last search.
+     */
+    count numberOfReachedNodes() const noexcept { return queueEnd; }
+
+    /**
+     * @return Number of neighbors inspected by the last search.
+     */
+    count getNeighborQueries() const noexcept { return neighborQueries; }
+
+private:
+    node source = none;
+    // Nodes reached from the source are stamped with ts, from the target with ts + 1 (only
+    // in bidirectional searches)
+    std::vector<uint32_t> timestamp;
+    uint32_t ts = 0;
+    std::vector<node> parent;
+    std::vector<count> distance;
+    // In bidirectional searches, the queue of the source side grows upwards from the front
+    // and the one of the target side downwards from the back
+    std::vector<node> queue;
+    index queueEnd = 0;
+    count neighborQueries = 0;
+
+    void prepare(const Graph &G, node source);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CYCLES_BLOCKED_BFS_HPP_
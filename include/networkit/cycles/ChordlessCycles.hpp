@@ -1,9 +1,17 @@
 #ifndef NETWORKIT_CYCLES_CHORDLESS_CYCLES_HPP_
 #define NETWORKIT_CYCLES_CHORDLESS_CYCLES_HPP_
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <memory>
+#include <string>
 
+#include <networkit/auxiliary/SignalHandling.hpp>
 #include <networkit/base/Algorithm.hpp>
+#include <networkit/cycles/BlockedBFS.hpp>
+#include <networkit/cycles/ChordlessCyclesMetrics.hpp>
+#include <networkit/cycles/CycleStore.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -18,7 +26,7 @@ public:
      * Construct the chordless cycle algorithm with the given graph and a callback.
      *
      * The callback is called once for each found chordless cycle
-     * with a reference to the chordless cycle.
+     * with a reference to the chordless cycle. If it returns false, the enumeration stops.
      * Note that the reference is to an internal object, the callback should not assume that
      * this reference is still valid after it returned.
      *
@@ -59,36 +67,215 @@ public:
     const std::vector<std::vector<node>> &getChordlessCycles() const;
 
     /**
-     * Print a basic report of hardware indepent metrics for last run
+     * Keep the found chordless cycles in a flat CycleStore, see getCycleStore(), instead of
+     * one vector per cycle. Has no effect if a callback was given.
+     *
+     * @param compressed Delta- and varint-compress the stored cycles.
      */
-    void report();
+    void setCompactStorage(bool compressed = false);
+
+    /**
+     * Write the found chordless cycles to the binary file @a path while they are found,
+     * in chunks of @a chunkSize bytes, instead of keeping them in memory. The file can be
+     * loaded by readCycleStream(). Has no effect if a callback was given. Parallel runs
+     * write the cycles in the order in which the threads find them.
+     */
+    void setOutputFile(const std::string &path, count chunkSize = 1 << 20);
+
+    /**
+     * Only count the found chordless cycles, in total and per length, see
+     * getLengthHistogram(), instead of keeping them. Has no effect if a callback was given.
+     */
+    void setCountingOnly();
+
+    /**
+     * Save the progress of run() to @a path at the start of an outer loop once
+     * @a intervalSeconds passed since the last save, when the enumeration stops early and
+     * when it finishes. resumeFrom() continues from the saved progress. The file is replaced
+     * atomically, so an interrupted save leaves the previous checkpoint intact.
+     */
+    void setCheckpointFile(const std::string &path, double intervalSeconds = 600);
+
+    /**
+     * Let the next run() continue from the checkpoint @a path, which must have been saved
+     * for the same graph, node order and direction. The outer loop interrupted last is
+     * repeated. Cycles found before the checkpoint count towards numberOfCycles(),
+     * getLengthHistogram() and the maximum number of cycles and remain in the output file,
+     * but are not stored again. Throws std::runtime_error if a callback was given, as it
+     * would see the cycles of the repeated loop twice.
+     */
+    void resumeFrom(const std::string &path);
+
+    /**
+     * Return all found chordless cycles if setCompactStorage() was used; throws otherwise.
+     */
+    const CycleStore &getCycleStore() const;
+
+    /**
+     * Return the number of found chordless cycles per length: entry i is the number of
+     * cycles with i nodes. Available unless a callback was given.
+     */
+    const std::vector<count> &getLengthHistogram() const;
+
+    /**
+     * @return Number of chordless cycles found, i.e., passed to the callback, stored or
+     * written to the output file.
+     */
+    count numberOfCycles() const;
+
+    /**
+     * @return Whether the last run stopped before all chordless cycles were enumerated
+     * because the callback returned false, the maximum number of cycles was reached or
+     * SIGINT was received. The cycles found until then are available as usual.
+     */
+    bool stoppedEarly() const;
+
+    /**
+     * Search for the paths suggested between two nodes and for the reachability of a node by
+     * bidirectional breadth-first search. The enumerated chordless cycles do not change.
+     */
+    void setBidirectional(bool bidirectional) { this->bidirectional = bidirectional; }
+
+    /**
+     * @return Hardware independent counters and phase timings of the last run. Nothing is
+     * printed unless ChordlessCyclesMetrics::print() or toJson() is used.
+     */
+    const ChordlessCyclesMetrics &getMetrics() const;
 
 protected:
     const Graph *G;
-    Graph G_copy;
+    Graph G_copy; // made by reset(), so instances only used by runForNewEdge() hold no copy
 
-    // Runtime metrics
-    unsigned int num_outer_loops = 0;
-    unsigned int num_inner_loops = 0;
-    unsigned int num_tree_nodes = 0;
-    unsigned int num_leafs = 0;
-    unsigned int bfsCalls = 0;
-    unsigned int unsuccessfulBfsCalls = 0;
-    unsigned int bfsNeighborQueries = 0;
+    // Runtime metrics, reset by run()
+    ChordlessCyclesMetrics metrics;
+    count untimedBfsCalls = 0;
 
     // Parameter
     std::vector<node> node_order;
     const unsigned int num_max_cyles;
+    bool hasCycleLimit() const noexcept {
+        return num_max_cyles != static_cast<unsigned int>(std::numeric_limits<int>::max());
+    }
     bool constructive;
+    bool bidirectional = false;
 
     std::vector<std::vector<node>> result;
     std::function<bool(const std::vector<node> &)> callback;
 
+    // Output unless a callback is given: result, cycleStore, outputStream or only counts
+    count numFoundCycles = 0;
+    std::vector<count> lengthHistogram;
+    bool countOnly = false;
+    bool compactStorage = false;
+    CycleStore cycleStore;
+    std::string outputFile;
+    count outputChunkSize = 0;
+    std::unique_ptr<CycleStreamWriter> outputStream;
+
+    // Progress before an outer loop: the loops before position in node_order are done
+    struct Checkpoint {
+        index position = 0;
+        count numFound = 0;
+        std::vector<count> lengthHistogram;
+        uint64_t outputSize = 0;
+    };
+    std::string checkpointFile;
+    double checkpointInterval = 0;
+    std::string resumeFile;
+    Checkpoint resumed;
+    uint64_t inputFingerprint = 0; // of the run, if it saves or resumes a checkpoint
+
+    // Cancellation: stopped is set once the enumeration is to be aborted. Parallel workers
+    // share the stop flag and the number of found cycles of the whole run.
+    bool stopped = false;
+    std::atomic<bool> *sharedStop = nullptr;
+    std::atomic<count> *sharedNumFound = nullptr;
+    Aux::SignalHandler *signalHandler = nullptr;
+
+    // Search workspace reused by all BFS helpers below
+    BlockedBFS blockedBFS;
+
+    // Neighbors of the current outer node whose cycles are enumerated already
+    std::vector<node> finishedNeighbors;
+
     virtual void destructiveEnumeration();
     virtual void constructiveEnumeration();
 
+    /**
+     * Run the outer loops from position resumed.position of node_order on, where @a blocked
+     * reflects the loops before; saves checkpoints if a checkpoint file is set.
+     */
+    void enumerateOuterLoops(std::vector<count> &blocked);
+
+    /**
+     * Read resumeFile into resumed, or reset resumed if none is given. Computes the
+     * fingerprint of the input if checkpoints are saved or resumed.
+     */
+    void loadCheckpoint();
+    void writeCheckpoint(const Checkpoint &checkpoint);
+    uint64_t checkpointFingerprint() const;
+
+    /**
+     * Enumerate all chordless cycles through @a u in G_copy restricted to the nodes that
+     * are not blocked. G_copy and @a blocked are restored before returning.
+     */
+    void enumerateCyclesThrough(node u, std::vector<count> &blocked);
+
+    /**
+     * Remove the neighbors of @a u except @a exception from the search by incrementing
+     * their blocked counters; unblockNeighbors() reverts this in O(deg(u)).
+     */
+    static void blockNeighbors(const Graph &g, node u, std::vector<count> &blocked,
+                               node exception);
+    static void unblockNeighbors(const Graph &g, node u, std::vector<count> &blocked,
+                                 node exception);
+
     virtual void reset();
+
+    /**
+     * Pass @a cycle to the callback or the selected output; stops the enumeration if the
+     * callback returns false or the maximum number of cycles is reached.
+     */
+    void reportCycle(const std::vector<node> &cycle);
+
+    /**
+     * @return Whether the enumeration is to be aborted. Checked on every tree node, such
+     * that the recursion unwinds promptly.
+     */
+    bool isStopped();
+    void stop();
+
+    /**
+     * Add the cycles counted by the parallel worker @a other in counting mode.
+     */
+    void addCounts(const ChordlessCycles &other);
+    void openOutput();
+    void closeOutput();
+
+    /**
+     * Return the result of the graph search @a search, timing every sampleInterval-th one.
+     */
+    template <typename Search>
+    auto timeBfs(Search &&search) -> decltype(search()) {
+        if (++untimedBfsCalls < ChordlessCyclesMetrics::sampleInterval)
+            return search();
+        untimedBfsCalls = 0;
+        const auto start = std::chrono::steady_clock::now();
+        auto result = search();
+        metrics.timedBfsCalls += 1;
+        metrics.timedBfsSeconds +=
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return result;
+    }
+
+    /**
+     * Search from @a start for @a target in @a g, which must not be blocked, using
+     * blockedBFS. Searches bidirectionally if enabled.
+     */
+    bool bfsTarget(const Graph &g, node start, node target, const std::vector<count> *blocked);
+
     bool bfsReachable(const Graph &g, node start, node target);
+    bool bfsReachable(const Graph &g, node start, node target, const std::vector<count> &blocked);
     std::vector<node> bfsPaths(const Graph &g, node start, node target, bool forward = true);
     std::vector<node> bfsPaths(const Graph &g, node start, node target,
                                const std::vector<count> &blocked, bool forward = true);
@@ -99,9 +286,12 @@ protected:
     std::vector<bool> bfsReachableMask(const Graph &g, node start,
                                        const std::vector<count> &blocked);
 
-private:
+    /**
+     * Enumerate all chordless paths from @a current to @a target that extend @a path in
+     * @a g without the blocked nodes. @a blocked is restored before returning.
+     */
     virtual void allChordlessPaths(const Graph &g, node current, node target,
-                                   const std::vector<node> &path);
+                                   const std::vector<node> &path, std::vector<count> &blocked);
 };
 
 } // namespace NetworKit
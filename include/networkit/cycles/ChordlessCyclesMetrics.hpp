@@ -0,0 +1,83 @@
+#ifndef NETWORKIT_CYCLES_CHORDLESS_CYCLES_METRICS_HPP_
+#define NETWORKIT_CYCLES_CHORDLESS_CYCLES_METRICS_HPP_
+
+#include <ostream>
+#include <string>
+
+#include <networkit/Globals.hpp>
+
+namespace NetworKit {
+
+/**
+ * Hardware independent counters and phase timings of a chordless cycle enumeration, see
+ * ChordlessCycles::getMetrics(). Parallel workers count on their own copy, which is added to
+ * the metrics of the run once they finish.
+ */
+struct ChordlessCyclesMetrics {
+    // Search
+    count outerLoops = 0;
+    count innerLoops = 0;
+    count treeNodes = 0;
+    count leafs = 0;
+    count cycles = 0;
+
+    // Graph searches and their neighbor queries
+    count bfsCalls = 0;
+    count unsuccessfulBfsCalls = 0;
+    count bfsNeighborQueries = 0;
+    count bidirectionalBfsCalls = 0;
+    // Every sampleInterval-th bidirectional search is repeated unidirectionally to
+    // estimate the neighbor queries saved
+    count sampledBfsCalls = 0;
+    count sampledUnidirectionalQueries = 0;
+    count sampledBidirectionalQueries = 0;
+
+    // Wall-clock seconds of the phases of run(): deriving the node order of the search,
+    // copying and decomposing the graph and the enumeration itself
+    double orderingSeconds = 0;
+    double preprocessingSeconds = 0;
+    double enumerationSeconds = 0;
+    count threads = 1;
+
+    // Every sampleInterval-th graph search is timed; bfsSeconds() extrapolates them
+    count timedBfsCalls = 0;
+    double timedBfsSeconds = 0;
+
+    static constexpr count sampleInterval = 64;
+
+    /**
+     * Add the counters of @a other, e.g. of a parallel worker; the phase timings and the
+     * number of threads are kept.
+     */
+    void add(const ChordlessCyclesMetrics &other);
+
+    /**
+     * @return Estimated seconds spent in graph searches, summed over all threads.
+     */
+    double bfsSeconds() const;
+
+    /**
+     * @return Estimated seconds spent in the enumeration outside of graph searches, summed
+     * over all threads.
+     */
+    double recursionSeconds() const;
+
+    /**
+     * @return Estimated number of neighbor queries saved by bidirectional searches.
+     */
+    double savedBfsNeighborQueries() const;
+
+    /**
+     * @return All counters and timings as a single JSON object.
+     */
+    std::string toJson() const;
+
+    /**
+     * Print all counters and timings, one per line.
+     */
+    void print(std::ostream &os) const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CYCLES_CHORDLESS_CYCLES_METRICS_HPP_
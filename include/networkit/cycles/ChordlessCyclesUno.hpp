@@ -20,9 +20,7 @@ public:
 
 private:
     void findChordlessCycles();
-    void chordlessPath(const Graph &g, node u, node v);
-    void findChordlessPath(const Graph &g, node current, node target,
-                           const std::vector<node> &path);
+    void chordlessPath(const Graph &g, node u, node v, std::vector<count> &blocked);
 };
 
 } // namespace NetworKit
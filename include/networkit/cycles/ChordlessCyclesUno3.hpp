@@ -19,10 +19,11 @@ class ChordlessCyclesUno3 final : public ChordlessCycles {
 
 private:
     void allChordlessPaths(const Graph &g, node start, node current,
-                           const std::vector<node> &path) override;
+                           const std::vector<node> &path, std::vector<count> &blocked) override;
     void allChordlessPathsFollow(const Graph &g, node current, node target,
                                  const std::vector<node> &path,
-                                 std::vector<node> &suggestedPathsReverse);
+                                 std::vector<node> &suggestedPathsReverse,
+                                 std::vector<count> &blocked);
 };
 
 } // namespace NetworKit
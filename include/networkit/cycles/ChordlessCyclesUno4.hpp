@@ -4,6 +4,7 @@
 #include <functional>
 
 #include <networkit/cycles/ChordlessCycles.hpp>
+#include <networkit/cycles/ReachabilityMarks.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -18,10 +19,13 @@ class ChordlessCyclesUno4 final : public ChordlessCycles {
     void reset() override;
 
 private:
+    // Nodes reachable from the target, one set per open allChordlessPathsFollow chain
+    ReachabilityMarks marks;
+
     void allChordlessPaths(const Graph &g, node start, node current,
-                           const std::vector<node> &path) override;
+                           const std::vector<node> &path, std::vector<count> &blocked) override;
     void allChordlessPathsFollow(const Graph &g, const std::vector<node> &path,
-                                 uid_t currentPosition, std::vector<bool> &marks, count minLength);
+                                 uid_t currentPosition, std::vector<count> &blocked);
 };
 
 } // namespace NetworKit
@@ -4,6 +4,7 @@
 #include <functional>
 
 #include <networkit/cycles/ChordlessCycles.hpp>
+#include <networkit/cycles/ReachabilityMarks.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -17,19 +18,146 @@ class ChordlessCyclesUno41 final : public ChordlessCycles {
 
     void reset() override;
 
+public:
+    /**
+     * Enumerate the chordless cycles through each node of the node order as an
+     * independent task. Every thread works on its own copy of the graph and its own
+     * blocked counters; tasks are handed out dynamically. The set of found cycles is
+     * identical to the sequential run, stored cycles are reported in node order.
+     * If a callback is given, it is never called concurrently.
+     *
+     * With @a splitBranches, a thread that runs out of tasks may additionally be handed
+     * unexplored sibling branches of the recursion tree of another thread, which keeps
+     * all threads busy if a few start nodes own most of the search.
+     *
+     * @param parallel Use all available threads during run().
+     * @param splitBranches Donate subtrees of running tasks to idle threads.
+     */
+    void setParallel(bool parallel, bool splitBranches = false) {
+        this->parallel = parallel;
+        this->splitBranches = splitBranches;
+    }
+
+    /**
+     * Only enumerate the chordless cycles with at least @a minLength and at most
+     * @a maxLength nodes. Branches of the search that cannot yield such a cycle are pruned:
+     * for the maximum by the distances to the target of the current inner loop, which only
+     * grow further down the search, for the minimum by the number of nodes reachable from
+     * the next node of a branch, which bounds the length of any induced path through it.
+     *
+     * @param minLength Minimum number of nodes of a cycle, at least 3.
+     * @param maxLength Maximum number of nodes of a cycle or none for no bound.
+     */
+    void setLengthBounds(count minLength, count maxLength = none);
+
+    /**
+     * Enumerate each biconnected component (block) of the graph on its own: every chordless
+     * cycle lies within a single block, so each block with at least three nodes is relabeled
+     * to a compact subgraph, searched with the node order restricted to it, and the found
+     * cycles are mapped back to the node ids of the graph. Stored cycles are reported block
+     * by block, largest block first.
+     *
+     * Together with setParallel(), the blocks are searched in parallel, largest first. Blocks
+     * that hold a large share of all nodes are instead searched one after another, each using
+     * all threads.
+     */
+    void setBlockDecomposition(bool blockDecomposition) {
+        this->blockDecomposition = blockDecomposition;
+    }
+
+    /**
+     * Estimated size of the search of run(), see estimateSearchTree().
+     */
+    struct SearchTreeEstimate {
+        // Calls of the recursion, found cycles and neighbor queries of the path searches
+        double treeNodes = 0;
+        double cycles = 0;
+        double bfsNeighborQueries = 0;
+        // Standard error of the estimated number of cycles
+        double cyclesStandardError = 0;
+        count probes = 0;
+    };
+
+    /**
+     * Estimate the size of the search of run() without running it by random probing of the
+     * recursion tree (Knuth, 1975): a probe picks a start node of the node order, an inner
+     * loop and then one child per tree node uniformly at random until it reaches a leaf.
+     * Weighting every visited node by the product of the numbers of choices above it gives
+     * unbiased estimates of the numbers of tree nodes and cycles. The node order, variant and
+     * length bounds are respected; the cycle limit is ignored.
+     *
+     * The neighbor queries count the path searches of every detour at each visited tree node
+     * and the marks set at the leaf. The searches that extend the marks when backtracking
+     * depend on the whole subtree and are not probed, so the queries are underestimated.
+     *
+     * Probes are repeated until @a seconds passed or @a maxProbes probes were made, using
+     * all threads if setParallel() was used, and their estimates averaged.
+     */
+    SearchTreeEstimate estimateSearchTree(double seconds, count maxProbes = none) const;
+
+    /**
+     * Enumerate only the chordless cycles that inserting the edge {@a u, @a v}, which must
+     * not be in the graph, would create: the induced paths between @a u and @a v with at
+     * least one inner node, each starting at @a u and ending at @a v. They are passed to
+     * the callback or the selected output as by run(), with the same length bounds and
+     * limit; the node order is ignored. Nothing is printed.
+     */
+    void runForNewEdge(node u, node v);
+
 protected:
     void destructiveEnumeration() override;
     void constructiveEnumeration() override;
 
 private:
+    struct Branch;
+    struct BranchScheduler;
+
+    bool parallel = false;
+    bool splitBranches = false;
+    bool blockDecomposition = false;
+    count minLength = 3;
+    count maxLength = none;
+
+    // Distances to the target of the current inner loop if maxLength is bounded
+    BlockedBFS distanceBFS;
+
+    // State of a parallel worker: the position in node_order of its current task
+    BranchScheduler *scheduler = nullptr;
+    index taskPosition = 0;
+
+    // Block worker whose callback writes to the output file of the enclosing run; the
+    // callback is thread-safe and enforces the cycle limit itself
+    bool forwardsOutput = false;
+
+    // Nodes reachable from the target, one set per open allChordlessPathsFollow chain
+    ReachabilityMarks marks;
+
+    // Blocked counters of runForNewEdge(), all zero between calls
+    std::vector<count> edgeBlocked;
+
+    void parallelEnumeration();
+    // Report a cycle of a worker to the output file of this run, from any thread; returns
+    // whether to go on
+    bool writeCycle(const std::vector<node> &cycle);
+    SearchTreeEstimate probeSearchTree(std::vector<count> &blocked);
+    void blockEnumeration();
+    void moveToPosition(index position, std::vector<count> &blocked);
+    void donateBranch(const std::vector<node> &path, uid_t currentPosition, node next);
+    void followBranch(const Branch &branch, std::vector<count> &blocked);
+    void followDetour(const Graph &g, std::vector<node> prefix, node next, node target,
+                      std::vector<count> &blocked);
+
+    void computeDistances(const Graph &g, node target, const std::vector<count> &blocked);
+    bool exceedsMaxLength(count prefixLength, node next) const;
+    std::vector<node> suggestPath(const Graph &g, count prefixLength, node next, node target,
+                                  const std::vector<count> &blocked);
+
     void allChordlessPaths(const Graph &g, node start, node current,
-                           const std::vector<node> &path, std::vector<count> blocked);
+                           const std::vector<node> &path, std::vector<count> &blocked) override;
 
     void allChordlessPathsFollow(const Graph &g, const std::vector<node> &path,
                                  uid_t currentPosition,
-                                 std::vector<bool> &marks,
-                                 std::vector<count> &blocked,
-                                 count minLength);
+                                 std::vector<count> &blocked);
 };
 
 } // namespace NetworKit
@@ -0,0 +1,137 @@
+#ifndef NETWORKIT_CYCLES_CYCLE_STORE_HPP_
+#define NETWORKIT_CYCLES_CYCLE_STORE_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * Flat storage of cycles: the nodes of all cycles are concatenated into one array and an
+ * offsets array marks where each cycle starts, as in a CSR graph. This avoids one heap
+ * allocation and vector header per cycle. Optionally, every cycle is compressed to its first
+ * node followed by the differences between consecutive nodes, all varint-encoded.
+ */
+class CycleStore final {
+
+public:
+    explicit CycleStore(bool compressed = false);
+
+    /**
+     * Append @a cycle to the store.
+     */
+    void add(const std::vector<node> &cycle);
+
+    /**
+     * Remove all cycles.
+     */
+    void clear();
+
+    /**
+     * @return Number of cycles in the store.
+     */
+    count size() const noexcept { return offsets.size() - 1; }
+
+    /**
+     * @return Sum of the lengths of all cycles in the store.
+     */
+    count numberOfNodes() const noexcept { return totalNodes; }
+
+    /**
+     * @return Whether the cycles are stored compressed.
+     */
+    bool isCompressed() const noexcept { return compressed; }
+
+    /**
+     * @return The @a i-th cycle in the order they were added.
+     */
+    std::vector<node> getCycle(index i) const;
+
+    /**
+     * Call @a handle with every cycle in the order they were added. The reference passed
+     * to @a handle is only valid during the call.
+     */
+    template <typename L>
+    void forCycles(L handle) const {
+        std::vector<node> cycle;
+        for (index i = 0; i < size(); ++i) {
+            decode(i, cycle);
+            handle(cycle);
+        }
+    }
+
+private:
+    bool compressed;
+    count totalNodes = 0;
+    // offsets[i] is the start of cycle i in nodes or, if compressed, in bytes
+    std::vector<index> offsets;
+    std::vector<node> nodes;
+    std::vector<uint8_t> bytes;
+
+    void decode(index i, std::vector<node> &cycle) const;
+};
+
+/**
+ * Writes cycles to a binary file as they are found. Cycles are encoded as in a compressed
+ * CycleStore, prefixed by their length, and buffered until @a chunkSize bytes are collected;
+ * then the chunk is written at once. The file is completed by flush() or when the writer is
+ * destroyed; the destructor only logs errors, so call flush() first to catch them.
+ */
+class CycleStreamWriter final {
+
+public:
+    /**
+     * Open @a path for writing; throws std::runtime_error if this fails.
+     */
+    explicit CycleStreamWriter(const std::string &path, count chunkSize = 1 << 20);
+
+    /**
+     * Continue the cycle file @a path, which holds @a numCycles cycles in its first
+     * @a resumeSize bytes; anything after them is cut off. Throws std::runtime_error if
+     * @a path is no cycle file of at least this size.
+     */
+    CycleStreamWriter(const std::string &path, count chunkSize, uint64_t resumeSize,
+                      count numCycles);
+
+    ~CycleStreamWriter();
+
+    /**
+     * Append @a cycle to the file.
+     */
+    void add(const std::vector<node> &cycle);
+
+    /**
+     * Write all buffered cycles to the file; throws std::runtime_error if this fails.
+     */
+    void flush();
+
+    /**
+     * @return Number of cycles added so far.
+     */
+    count numberOfCycles() const noexcept { return numCycles; }
+
+    /**
+     * @return Size of the file in bytes once all buffered cycles are written.
+     */
+    uint64_t size() const noexcept { return written + buffer.size(); }
+
+private:
+    std::ofstream out;
+    count chunkSize;
+    count numCycles = 0;
+    uint64_t written = 0;
+    std::vector<uint8_t> buffer;
+};
+
+/**
+ * Read all cycles of a file written by CycleStreamWriter into a CycleStore.
+ */
+CycleStore readCycleStream(const std::string &path, bool compressed = false);
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CYCLES_CYCLE_STORE_HPP_
@@ -0,0 +1,120 @@
+#ifndef NETWORKIT_CYCLES_DYN_CHORDLESS_CYCLES_HPP_
+#define NETWORKIT_CYCLES_DYN_CHORDLESS_CYCLES_HPP_
+
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/base/DynAlgorithm.hpp>
+#include <networkit/cycles/ChordlessCyclesUno41.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * Maintains all chordless cycles of an undirected graph under edge insertions and deletions.
+ *
+ * run() enumerates the cycles once; afterwards, update() only touches the cycles affected by
+ * an event. Inserting {u, v} destroys the cycles through u and v, for which it is a chord,
+ * and creates the induced paths between u and v closed by it, which are searched by
+ * ChordlessCyclesUno41::runForNewEdge(). Deleting {u, v} destroys the cycles through the
+ * edge and creates the cycles whose only chord it was: each consists of two destroyed cycles
+ * without the edge whose inner nodes are disjoint and not adjacent. Every update thus costs
+ * one path search per created cycle plus time linear in the cycles through u and v.
+ *
+ * The events are replayed on an internal copy of the graph, so a batch may be passed after
+ * all of its events were applied to the graph.
+ */
+class DynChordlessCycles final : public Algorithm, public DynAlgorithm {
+
+public:
+    /**
+     * @param G The undirected graph to maintain the chordless cycles for.
+     */
+    DynChordlessCycles(const Graph &G);
+
+    /**
+     * Enumerate all chordless cycles of the graph given in the constructor.
+     */
+    void run() override;
+
+    /**
+     * Update the chordless cycles after an edge insertion or deletion. Removing a node also
+     * removes the cycles through its edges; weight changes have no effect.
+     *
+     * @param e The event that happened.
+     */
+    void update(GraphEvent e) override;
+
+    /**
+     * Update the chordless cycles after a batch of events, in their order.
+     *
+     * @param batch The events that happened.
+     */
+    void updateBatch(const std::vector<GraphEvent> &batch) override;
+
+    /**
+     * @return Number of chordless cycles of the current graph.
+     */
+    count numberOfCycles() const;
+
+    /**
+     * @return All chordless cycles of the current graph, in no particular order.
+     */
+    std::vector<std::vector<node>> getChordlessCycles() const;
+
+    /**
+     * @return The cycles created by the last update() or updateBatch(). A cycle created and
+     * destroyed again within a batch is contained in both lists.
+     */
+    const std::vector<std::vector<node>> &getAddedCycles() const;
+
+    /**
+     * @return The cycles destroyed by the last update() or updateBatch().
+     */
+    const std::vector<std::vector<node>> &getRemovedCycles() const;
+
+private:
+    const Graph *G;
+
+    // The graph as of the last processed event and the search for cycles on it; both on the
+    // heap, as the search refers to the graph
+    std::unique_ptr<Graph> current;
+    std::unique_ptr<ChordlessCyclesUno41> search;
+
+    // Cycles by id; ids of removed cycles are reused
+    std::vector<std::vector<node>> cycles;
+    std::vector<index> freeIds;
+    std::vector<std::unordered_set<index>> cyclesOfNode;
+
+    std::vector<std::vector<node>> added;
+    std::vector<std::vector<node>> removed;
+
+    // Inner nodes of the path checked last in addCombinedCycles()
+    std::vector<index> stamp;
+    index currentStamp = 0;
+
+    void apply(const GraphEvent &e);
+    void addEdge(node u, node v);
+    void removeEdge(node u, node v);
+    void addCycle(std::vector<node> cycle);
+    void removeCycle(index id);
+
+    /**
+     * @return Ids of the cycles through both @a u and @a v; if @a consecutive, only those
+     * that contain the edge {u, v}.
+     */
+    std::vector<index> cyclesThrough(node u, node v, bool consecutive) const;
+
+    /**
+     * Add the cycles formed by two of the paths from u to v that remain of the cycles
+     * destroyed by deleting {u, v}, which was the only chord of these cycles.
+     */
+    void addCombinedCycles(const std::vector<std::vector<node>> &paths);
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CYCLES_DYN_CHORDLESS_CYCLES_HPP_
@@ -3,10 +3,12 @@
 
 #include "iostream"
 #include <functional>
+#include <string>
 
 #include "networkit/centrality/Betweenness.hpp"
 #include "networkit/structures/Partition.hpp"
 #include <networkit/base/Algorithm.hpp>
+#include <networkit/cycles/ChordlessCyclesUno41.hpp>
 #include <networkit/graph/Graph.hpp>
 
 namespace NetworKit {
@@ -17,7 +19,97 @@ std::vector<node> randomOrderedNodes(const Graph &g, int seed);
 std::vector<node> smallestFirstOrderedNodes(const Graph &g);
 std::vector<node> fastSmallestFirstOrderedNodes(const Graph &g, const Partition &p);
 std::vector<node> largestFirstOrderedNodes(const Graph &g);
+
+/**
+ * Order the nodes of @a g such that every node has at most k neighbors after it, k being the
+ * degeneracy, like smallestFirstOrderedNodes() but in O(n + m) time, in parallel and without
+ * copying the graph (CoreDecomposition with ParK). With @a p, only edges within the subsets
+ * of @a p count, like in fastSmallestFirstOrderedNodes(). @a g must not have self-loops.
+ */
+std::vector<node> degeneracyOrderedNodes(const Graph &g);
+std::vector<node> degeneracyOrderedNodes(const Graph &g, const Partition &p);
 std::vector<node> pageRankOrderedNodes(const Graph &g);
+
+/**
+ * Result of selectNodeOrder(): the evaluated candidate orders and the chosen one.
+ */
+struct NodeOrderChoice {
+    struct Candidate {
+        std::string name;
+        // Time to compute the order and to estimate the search with it
+        double orderSeconds = 0;
+        double estimateSeconds = 0;
+        ChordlessCyclesUno41::SearchTreeEstimate estimate;
+
+        // Estimated work of the enumeration: tree nodes plus neighbor queries
+        double cost() const { return estimate.treeNodes + estimate.bfsNeighborQueries; }
+    };
+
+    std::vector<Candidate> candidates;
+    index chosen = none;
+    std::vector<node> order;
+    // Total time of the selection
+    double seconds = 0;
+
+    /**
+     * Print the candidates, their estimates and costs, and the decision.
+     */
+    void report() const;
+};
+
+/**
+ * Choose a node order for ChordlessCyclesUno41 on @a g: each candidate order (degeneracy
+ * and page rank, each also reversed, estimated betweenness and random) is computed and the
+ * search with it estimated by ChordlessCyclesUno41::estimateSearchTree() for
+ * @a secondsPerOrder; the order of least estimated work is chosen.
+ *
+ * @param constructive Variant of the enumeration to choose the order for.
+ * @param parallel Probe the search with all threads.
+ */
+NodeOrderChoice selectNodeOrder(const Graph &g, bool constructive = true,
+                                double secondsPerOrder = 1.0, bool parallel = true);
+
+/**
+ * Result of reduceForCycles(): the reduced graph and everything needed to map its chordless
+ * cycles back to the input graph.
+ */
+struct CycleReduction {
+    Graph reducedGraph;
+
+    // Chordless cycles of the input graph through removed nodes, found during the reduction
+    std::vector<std::vector<node>> cycles;
+
+    // Input graph node of each node of reducedGraph
+    std::vector<node> originalIds;
+
+    // Per node of reducedGraph standing for a contracted induced path: the input graph nodes
+    // of the path, ordered from the neighbor chainLeft to the neighbor chainRight; empty for
+    // all other nodes
+    std::vector<std::vector<node>> chainNodes;
+    std::vector<node> chainLeft;
+    std::vector<node> chainRight;
+
+    count numBridges = 0;
+    count numInducedPaths = 0;
+    count numCCs = 0;
+
+    /**
+     * Map a chordless cycle of reducedGraph to the corresponding chordless cycle of the
+     * input graph.
+     */
+    std::vector<node> expand(const std::vector<node> &cycle) const;
+};
+
+/**
+ * Reduce @a g for chordless cycle enumeration: bridges and isolated nodes are removed,
+ * induced paths of degree two nodes are contracted to a single node, and such paths closing
+ * a chordless cycle are removed after recording the cycle. The chordless cycles of @a g are
+ * exactly the recorded ones plus the expanded chordless cycles of the reduced graph.
+ *
+ * @param compact Relabel the reduced graph to continuous node ids.
+ */
+CycleReduction reduceForCycles(const Graph &g, bool compact = false);
+
 Graph preprocessedGraph(const Graph &g);
 Graph degTwoPreproGraph(const Graph &g);
 
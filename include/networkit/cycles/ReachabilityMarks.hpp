@@ -0,0 +1,80 @@
+#ifndef NETWORKIT_CYCLES_REACHABILITY_MARKS_HPP_
+#define NETWORKIT_CYCLES_REACHABILITY_MARKS_HPP_
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * A stack of node sets as used for the reachability marks of the chordless cycle
+ * enumerators. Only the set on top is accessible. Every node stores the id of the
+ * innermost set it was marked in; the previous id is kept on a trail and restored when the
+ * set is popped. Clearing, pushing and marking take constant time, popping is linear in the
+ * number of marks made since the corresponding push, so no operation depends on the number
+ * of nodes in the graph.
+ */
+class ReachabilityMarks final {
+
+public:
+    /**
+     * Create the marks for graphs with up to @a upperNodeIdBound nodes; they grow if they
+     * are used on a larger graph.
+     */
+    explicit ReachabilityMarks(count upperNodeIdBound = 0);
+
+    /**
+     * Open a new, empty set on top of the current one.
+     */
+    void push();
+
+    /**
+     * Discard the set on top, restoring the one below.
+     */
+    void pop();
+
+    /**
+     * Replace the set on top by an empty one.
+     */
+    void clear() { current = ++lastId; }
+
+    /**
+     * @return Whether @a u is in the set on top.
+     */
+    bool isMarked(node u) const { return u < stamp.size() && stamp[u] == current; }
+
+    /**
+     * @return Whether a neighbor of @a u in @a G is in the set on top.
+     */
+    bool hasMarkedNeighbor(const Graph &G, node u) const;
+
+    /**
+     * Add @a start and all nodes reachable from it in @a G via nodes that are neither
+     * marked nor blocked to the set on top.
+     *
+     * @return Number of neighbors inspected.
+     */
+    count markReachable(const Graph &G, node start, const std::vector<count> &blocked);
+
+private:
+    std::vector<uint64_t> stamp;
+    uint64_t current = 0;
+    uint64_t lastId = 0;
+    // Previous stamps of the marked nodes, and per open set the trail size and the id of
+    // the set below
+    std::vector<std::pair<node, uint64_t>> trail;
+    std::vector<std::pair<index, uint64_t>> sets;
+    std::vector<node> queue;
+
+    void mark(node u) {
+        trail.emplace_back(u, stamp[u]);
+        stamp[u] = current;
+    }
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_CYCLES_REACHABILITY_MARKS_HPP_
@@ -0,0 +1,238 @@
+#ifndef NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+#define NETWORKIT_GRAPH_CSR_GRAPH_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/auxiliary/FunctionTraits.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+/**
+ * Immutable snapshot of a Graph in compressed sparse row format: the neighbors of all nodes
+ * are stored in one contiguous array, delimited by per-node offsets, and weights and edge ids
+ * in parallel arrays if the graph has them. Scanning a neighborhood thus reads consecutive
+ * memory instead of a separately allocated vector per node.
+ *
+ * Node ids are those of the graph, including deleted ones, and neighbors appear in the order
+ * of the graph. The iteration methods mirror those of Graph, so algorithms templated over the
+ * graph type run on either.
+ *
+ * @tparam Id Type of the stored neighbor and edge ids; uint32_t halves the memory of the
+ * arrays for graphs with less than 2^32 node and edge ids.
+ */
+template <typename Id = node>
+class CSRGraphT final {
+    static_assert(std::is_unsigned<Id>::value, "Id must be an unsigned integer type");
+
+public:
+    /**
+     * Contiguous range of the neighbors of a node.
+     */
+    class NeighborRange {
+        const Id *first;
+        const Id *last;
+
+    public:
+        NeighborRange(const Id *first, const Id *last) : first(first), last(last) {}
+
+        const Id *begin() const noexcept { return first; }
+        const Id *end() const noexcept { return last; }
+        count size() const noexcept { return static_cast<count>(last - first); }
+    };
+
+    /**
+     * Copy @a G into compressed sparse row format, in parallel.
+     *
+     * @param G The graph to copy.
+     */
+    explicit CSRGraphT(const Graph &G);
+
+    count numberOfNodes() const noexcept { return n; }
+    count numberOfEdges() const noexcept { return m; }
+    index upperNodeIdBound() const noexcept { return z; }
+    bool isDirected() const noexcept { return directed; }
+    bool isWeighted() const noexcept { return !outWeights.empty(); }
+    bool hasEdgeIds() const noexcept { return !outEdgeIds.empty(); }
+    bool hasNode(node u) const noexcept { return u < z && exists[u]; }
+
+    /**
+     * @return Number of outgoing neighbors of @a u.
+     */
+    count degree(node u) const { return outOffsets[u + 1] - outOffsets[u]; }
+
+    /**
+     * @return Number of incoming neighbors of @a u; equals degree() for undirected graphs.
+     */
+    count degreeIn(node u) const {
+        return directed ? inOffsets[u + 1] - inOffsets[u] : degree(u);
+    }
+
+    /**
+     * @return The outgoing neighbors of @a u.
+     */
+    NeighborRange neighborRange(node u) const {
+        return NeighborRange(outNeighbors.data() + outOffsets[u],
+                             outNeighbors.data() + outOffsets[u + 1]);
+    }
+
+    /**
+     * @return The incoming neighbors of @a u; equals neighborRange() for undirected graphs.
+     */
+    NeighborRange inNeighborRange(node u) const {
+        if (!directed)
+            return neighborRange(u);
+        return NeighborRange(inNeighbors.data() + inOffsets[u],
+                             inNeighbors.data() + inOffsets[u + 1]);
+    }
+
+    /**
+     * @return Size of the arrays of the snapshot in bytes.
+     */
+    count memoryUsage() const;
+
+    /**
+     * Iterate over all nodes of the graph and call @a handle (lambda closure).
+     */
+    template <typename L>
+    void forNodes(L handle) const {
+        for (node u = 0; u < z; ++u)
+            if (exists[u])
+                handle(u);
+    }
+
+    /**
+     * Iterate in parallel over all nodes of the graph and call @a handle (lambda closure).
+     */
+    template <typename L>
+    void parallelForNodes(L handle) const {
+#pragma omp parallel for
+        for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+            if (exists[u])
+                handle(static_cast<node>(u));
+    }
+
+    /**
+     * Iterate over the outgoing neighbors of @a u and call @a handle (lambda closure), which
+     * takes the same parameters as for Graph::forNeighborsOf(): <code>(node)</code>,
+     * <code>(node, edgeweight)</code>, <code>(node, node)</code>, <code>(node, node,
+     * edgeweight)</code>, <code>(node, node, edgeid)</code> or <code>(node, node,
+     * edgeweight, edgeid)</code>.
+     */
+    template <typename L>
+    void forNeighborsOf(node u, L handle) const {
+        forEdgesOfImpl(u, outOffsets, outNeighbors, outWeights, outEdgeIds, handle);
+    }
+
+    /**
+     * Iterate over the incoming neighbors of @a u and call @a handle (lambda closure), see
+     * forNeighborsOf(). Equals forNeighborsOf() for undirected graphs.
+     */
+    template <typename L>
+    void forInNeighborsOf(node u, L handle) const {
+        if (directed)
+            forEdgesOfImpl(u, inOffsets, inNeighbors, inWeights, inEdgeIds, handle);
+        else
+            forNeighborsOf(u, handle);
+    }
+
+private:
+    count n;
+    count m;
+    count z;
+    bool directed;
+    std::vector<bool> exists;
+
+    std::vector<index> outOffsets;
+    std::vector<Id> outNeighbors;
+    std::vector<edgeweight> outWeights;
+    std::vector<Id> outEdgeIds;
+
+    // Only filled for directed graphs
+    std::vector<index> inOffsets;
+    std::vector<Id> inNeighbors;
+    std::vector<edgeweight> inWeights;
+    std::vector<Id> inEdgeIds;
+
+    template <typename L>
+    void forEdgesOfImpl(node u, const std::vector<index> &offsets, const std::vector<Id> &ids,
+                        const std::vector<edgeweight> &weights, const std::vector<Id> &edgeIds,
+                        L &handle) const {
+        for (index i = offsets[u]; i < offsets[u + 1]; ++i)
+            edgeLambda(handle, u, static_cast<node>(ids[i]),
+                       weights.empty() ? defaultEdgeWeight : weights[i],
+                       edgeIds.empty() ? none : static_cast<edgeid>(edgeIds[i]));
+    }
+
+    /*
+     * Call @a f with the parameters it takes, as Graph::edgeLambda() does; the node and
+     * weight parameters are told apart by their exact types, as they convert into each other.
+     */
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 3)
+                  && std::is_same<edgeweight,
+                                  typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+                  && std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<3>::type>::
+                      value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid id)
+        -> decltype(f(u, v, ew, id)) {
+        return f(u, v, ew, id);
+    }
+
+    template <
+        class F,
+        typename std::enable_if<
+            (Aux::FunctionTraits<F>::arity >= 2)
+            && std::is_same<edgeid, typename Aux::FunctionTraits<F>::template arg<2>::type>::value
+            && std::is_same<node, typename Aux::FunctionTraits<F>::template arg<1>::type>::
+                value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight, edgeid id) -> decltype(f(u, v, id)) {
+        return f(u, v, id);
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 2)
+                  && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
+                                                  2>::type>::value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight ew, edgeid) -> decltype(f(u, v, ew)) {
+        return f(u, v, ew);
+    }
+
+    template <class F, typename std::enable_if<
+                           (Aux::FunctionTraits<F>::arity >= 1)
+                           && std::is_same<node, typename Aux::FunctionTraits<F>::template arg<
+                                                     1>::type>::value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node u, node v, edgeweight, edgeid) -> decltype(f(u, v)) {
+        return f(u, v);
+    }
+
+    template <class F,
+              typename std::enable_if<
+                  (Aux::FunctionTraits<F>::arity >= 1)
+                  && std::is_same<edgeweight, typename Aux::FunctionTraits<F>::template arg<
+                                                  1>::type>::value>::type * = (void *)0>
+    static auto edgeLambda(F &f, node, node v, edgeweight ew, edgeid) -> decltype(f(v, ew)) {
+        return f(v, ew);
+    }
+
+    template <class F, void * = (void *)0>
+    static auto edgeLambda(F &f, node, node v, edgeweight, edgeid) -> decltype(f(v)) {
+        return f(v);
+    }
+};
+
+using CSRGraph = CSRGraphT<node>;
+using CSRGraph32 = CSRGraphT<uint32_t>;
+
+extern template class CSRGraphT<node>;
+extern template class CSRGraphT<uint32_t>;
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_CSR_GRAPH_HPP_
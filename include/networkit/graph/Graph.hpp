@@ -117,6 +117,8 @@ class Graph final {
     bool directed;
     //!< true if edge ids have been assigned
     bool edgesIndexed;
+    //!< true if the adjacency arrays are kept sorted by node id, see setSortedAdjacency()
+    bool sortedAdjacency = false;
 
     // per node data
     //!< exists[v] is true if node v has not been removed from the graph
@@ -151,6 +153,36 @@ class Graph final {
      */
     index indexInOutEdgeArray(node u, node v) const;
 
+    /**
+     * Returns the index at which an edge to v is inserted into @a adjacency: the end, or
+     * behind all neighbors up to v if the adjacency arrays are kept sorted.
+     */
+    index insertionIndex(const std::vector<node> &adjacency, node v) const;
+
+    /**
+     * Inserts @a value at index @a idx of vec[u].
+     */
+    template <typename T>
+    static void insertAt(node u, index idx, const T &value, std::vector<std::vector<T>> &vec);
+
+    /**
+     * Removes index @a idx of vec[u], keeping the order if the adjacency arrays are sorted.
+     */
+    template <typename T>
+    void eraseAt(node u, index idx, std::vector<std::vector<T>> &vec);
+
+    void removeNodesImpl(std::vector<node> nodes);
+    void clearAdjacentEdges(node u);
+    void removeEdgesImpl(std::vector<std::pair<node, node>> edges);
+
+    /**
+     * Removes one entry of the adjacency array of u per entry of the sorted range
+     * [@a first, @a last) of neighbors; returns the number of entries of the range found.
+     * With @a dryRun, only counts them.
+     */
+    count removeListedNeighbors(node u, const node *first, const node *last, bool edgesIn,
+                                bool dryRun);
+
     /**
      * Computes the weighted in/out degree of node @a u.
      *
@@ -1115,6 +1147,21 @@ public:
     template <class Lambda>
     void sortEdges(Lambda lambda);
 
+    /**
+     * Keep the adjacency arrays sorted by node id. Enabling sorts them; afterwards, edge
+     * insertions and removals preserve the order, which makes them linear in the degree,
+     * while hasEdge(), edgeId(), weight() and removeEdge() find an edge by binary search
+     * in O(log(degree)). swapEdge() and sortEdges() with a custom criterion disable the mode.
+     *
+     * @param sorted Whether the adjacency arrays are kept sorted.
+     */
+    void setSortedAdjacency(bool sorted = true);
+
+    /**
+     * @return <code>true</code> if the adjacency arrays are kept sorted by node id.
+     */
+    bool hasSortedAdjacency() const noexcept { return sortedAdjacency; }
+
     /**
      * Set edge count of the graph to edges.
      * @param edges the edge count of a graph
@@ -1159,6 +1206,19 @@ public:
      */
     void removeNode(node v);
 
+    /**
+     * Remove the nodes in the range [@a first, @a last) and all incident edges from the graph.
+     * Only the adjacency arrays of the removed nodes and their neighbors are touched; the
+     * latter are compacted in parallel, keeping their order, weights and edge ids.
+     *
+     * @param first The first node of the range.
+     * @param last The end of the range.
+     */
+    template <class InputIt>
+    void removeNodes(InputIt first, InputIt last) {
+        removeNodesImpl(std::vector<node>(first, last));
+    }
+
     /**
      * Removes out-going edges from node @u. If the graph is weighted and/or has edge ids, weights
      * and/or edge ids will also be removed.
@@ -1330,6 +1390,19 @@ public:
      */
     void removeEdge(node u, node v);
 
+    /**
+     * Remove the edges in the range [@a first, @a last) of std::pair<node, node>. Every edge
+     * must exist as often as it occurs in the range. The adjacency arrays of the end points
+     * are compacted in parallel, keeping their order, weights and edge ids.
+     *
+     * @param first The first edge of the range.
+     * @param last The end of the range.
+     */
+    template <class InputIt>
+    void removeEdges(InputIt first, InputIt last) {
+        removeEdgesImpl(std::vector<std::pair<node, node>>(first, last));
+    }
+
     /**
      * Removes all the edges in the graph.
      */
@@ -2244,35 +2317,37 @@ std::pair<count, count> Graph::removeAdjacentEdges(node u, Condition condition,
     count removedSelfLoops = 0;
 
     // For directed graphs, this function is supposed to be called twice: one to remove out-edges,
-    // and one to remove in-edges.
+    // and one to remove in-edges. The remaining edges keep their order.
     auto &edges_ = edgesIn ? inEdges[u] : outEdges[u];
-    for (index vi = 0; vi < edges_.size();) {
+    auto *weights_ = isWeighted() ? &(edgesIn ? inEdgeWeights[u] : outEdgeWeights[u]) : nullptr;
+    auto *edgeIds_ = hasEdgeIds() ? &(edgesIn ? inEdgeIds[u] : outEdgeIds[u]) : nullptr;
+    index kept = 0;
+    for (index vi = 0; vi < edges_.size(); ++vi) {
         if (condition(edges_[vi])) {
             const auto isSelfLoop = (edges_[vi] == u);
             removedSelfLoops += isSelfLoop;
             removedEdges += !isSelfLoop;
-            edges_[vi] = edges_.back();
-            edges_.pop_back();
-            if (isWeighted()) {
-                auto &weights_ = edgesIn ? inEdgeWeights[u] : outEdgeWeights[u];
-                weights_[vi] = weights_.back();
-                weights_.pop_back();
-            }
-            if (hasEdgeIds()) {
-                auto &edgeIds_ = edgesIn ? inEdgeIds[u] : outEdgeIds[u];
-                edgeIds_[vi] = edgeIds_.back();
-                edgeIds_.pop_back();
-            }
-        } else {
-            ++vi;
+            continue;
         }
+        edges_[kept] = edges_[vi];
+        if (weights_)
+            (*weights_)[kept] = (*weights_)[vi];
+        if (edgeIds_)
+            (*edgeIds_)[kept] = (*edgeIds_)[vi];
+        ++kept;
     }
-
+    edges_.resize(kept);
+    if (weights_)
+        weights_->resize(kept);
+    if (edgeIds_)
+        edgeIds_->resize(kept);
     return {removedEdges, removedSelfLoops};
 }
 
 template <class Lambda>
 void Graph::sortEdges(Lambda lambda) {
+    // The custom order need not be by node id
+    sortedAdjacency = false;
 
     std::vector<std::vector<index>> indicesGlobal(omp_get_max_threads());
 
@@ -409,6 +409,17 @@ std::vector<node> invertContinuousNodeIds(const std::unordered_map<node, node> &
  */
 Graph restoreGraph(const std::vector<node> &invertedIdMap, const Graph &G);
 
+/**
+ * Constructs a graph with the nodes relabeled by a permutation, in parallel. Weights, edge ids
+ * and the order of the neighbors are kept; see NodeRelabeling for permutations which improve
+ * the locality of traversals.
+ * @param  G           The input graph.
+ * @param  permutation For each node id of @a G its new id in [0, n), or none for deleted
+ *                     nodes; the new ids must be distinct.
+ * @return             The relabeled graph with the node ids [0, n).
+ */
+Graph getPermutedGraph(const Graph &G, const std::vector<node> &permutation);
+
 /**
  * Sorts the adjacency arrays by increasing or decreasing edge weight. Edge ids are used
  * to break ties.
@@ -0,0 +1,130 @@
+#ifndef NETWORKIT_GRAPH_NODE_RELABELING_HPP_
+#define NETWORKIT_GRAPH_NODE_RELABELING_HPP_
+
+#include <cassert>
+#include <type_traits>
+#include <vector>
+
+#include <networkit/Globals.hpp>
+#include <networkit/base/Algorithm.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/structures/Partition.hpp>
+
+namespace NetworKit {
+
+/**
+ * Computes a relabeling of the nodes of a graph to the continuous ids 0 to n-1 that places
+ * nodes which are accessed together close to each other, so traversals of the relabeled graph
+ * touch fewer cache lines. Results computed on the relabeled graph are mapped back to the ids
+ * of the input graph with mapBack().
+ *
+ * Directed graphs are treated as undirected when ordering, i.e. in- and out-neighbors both
+ * count as neighbors.
+ */
+class NodeRelabeling final : public Algorithm {
+public:
+    enum class Order {
+        /// Breadth-first search order, one search per connected component.
+        BFS,
+        /// Reverse Cuthill-McKee: breadth-first search from nodes of minimum degree, visiting
+        /// neighbors by increasing degree, reversed. Reduces the bandwidth of the adjacency
+        /// matrix.
+        REVERSE_CUTHILL_MCKEE,
+        /// By decreasing degree, which packs the high-degree nodes together.
+        DEGREE,
+        /// In the order in which the nodes are peeled in the core decomposition.
+        DEGENERACY,
+        /// By community, communities and nodes within them in breadth-first search order.
+        COMMUNITY
+    };
+
+    /**
+     * @param G The graph.
+     * @param order The order of the new node ids; COMMUNITY needs the communities, see the
+     * other constructor.
+     */
+    NodeRelabeling(const Graph &G, Order order = Order::REVERSE_CUTHILL_MCKEE);
+
+    /**
+     * Relabel by community.
+     *
+     * @param G The graph.
+     * @param communities Partition of the nodes of @a G, e.g. computed by PLM. Nodes in no
+     * subset are treated as singletons.
+     */
+    NodeRelabeling(const Graph &G, const Partition &communities);
+
+    /**
+     * Computes the relabeling.
+     */
+    void run() override;
+
+    /**
+     * @return For each node id of the input graph its new id, or none for deleted nodes.
+     */
+    const std::vector<node> &getPermutation() const {
+        assureFinished();
+        return permutation;
+    }
+
+    /**
+     * @return For each new id the node id in the input graph.
+     */
+    const std::vector<node> &getInversePermutation() const {
+        assureFinished();
+        return inversePermutation;
+    }
+
+    /**
+     * @return The input graph with the nodes relabeled, see GraphTools::getPermutedGraph().
+     */
+    Graph getRelabeledGraph() const;
+
+    /**
+     * Map values indexed by the new ids back to the node ids of the input graph, in parallel;
+     * hence @a T must not be bool.
+     *
+     * @param values Value for each node of the relabeled graph.
+     * @param deleted Value of the deleted nodes of the input graph.
+     * @return Value for each node id of the input graph.
+     */
+    template <typename T>
+    std::vector<T> mapBack(const std::vector<T> &values, T deleted = T()) const {
+        static_assert(!std::is_same<T, bool>::value, "std::vector<bool> is not thread-safe");
+        assureFinished();
+        assert(values.size() == inversePermutation.size());
+        std::vector<T> result(permutation.size(), deleted);
+#pragma omp parallel for
+        for (omp_index i = 0; i < static_cast<omp_index>(inversePermutation.size()); ++i)
+            result[inversePermutation[i]] = values[i];
+        return result;
+    }
+
+private:
+    const Graph *G;
+    Order order;
+    const Partition *communities = nullptr;
+
+    std::vector<node> permutation;
+    std::vector<node> inversePermutation;
+
+    count undirectedDegree(node u) const {
+        return G->isDirected() ? G->degreeOut(u) + G->degreeIn(u) : G->degree(u);
+    }
+
+    template <typename L>
+    void forUndirectedNeighborsOf(node u, L handle) const {
+        G->forNeighborsOf(u, handle);
+        if (G->isDirected())
+            G->forInNeighborsOf(u, handle);
+    }
+
+    std::vector<node> bfsOrder(bool cuthillMcKee) const;
+    std::vector<node> degreeOrder() const;
+    std::vector<node> degeneracyOrder() const;
+    std::vector<node> communityOrder() const;
+};
+
+} // namespace NetworKit
+
+#endif // NETWORKIT_GRAPH_NODE_RELABELING_HPP_
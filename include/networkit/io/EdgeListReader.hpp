@@ -32,9 +32,16 @@ public:
      * @param[in]  commentPrefix  prefix of comment lines
      * @param[in]  continuous  boolean to specify if node ids are continuous
      * @param[in]  directed  read graph as directed
+     * @param[in]  parallel  parse the file in chunks on all threads; only used with
+     * continuous node ids. For well-formed files, the graph is the same as the one read
+     * sequentially. This trades memory for speed: all edges are parsed before the graph is
+     * built. Besides the graph and the mapped file, the reader holds 16 bytes per edge until
+     * the edges are sorted into adjacency arrays, and 16 bytes per adjacency entry until the
+     * graph is built; 24 bytes each for weighted files. Read sequentially if the graph barely
+     * fits into memory.
      */
     EdgeListReader(char separator, node firstNode, const std::string &commentPrefix = "#",
-                   bool continuous = true, bool directed = false);
+                   bool continuous = true, bool directed = false, bool parallel = false);
 
     /**
      * Given the path of an input file, read the graph contained.
@@ -55,6 +62,9 @@ private:
     bool continuous;
     std::map<std::string, node> mapNodeIds;
     bool directed;
+    bool parallel;
+
+    Graph readParallel(const char *begin, const char *end) const;
 };
 
 } /* namespace NetworKit */
@@ -1897,7 +1897,7 @@ cdef class CoreDecomposition(Centrality):
 	enforceBucketQueueAlgorithm : bool
 		enforce switch to sequential algorithm
 	storeNodeOrder : bool
-		If set to True, the order of the nodes in ascending order of the cores is stored and can later be returned using getNodeOrder(). Enforces the sequential bucket priority queue algorithm.
+		If set to True, the order of the nodes in ascending order of the cores is stored and can later be returned using getNodeOrder(). The order is a degeneracy order: every node has at most its core number neighbors after it.
 
 	"""
 
@@ -181,7 +181,7 @@ void ApproxElectricalCloseness::computeNodeSequence() {
     // root's biconnected component. If the root is in multiple biconnected components, we take one
     // of them arbitrarily select one of them.
     std::queue<std::pair<node, index>> q;
-    const auto &rootComps = bcc.getComponentsOfNode(root);
+    const auto rootComps = bcc.componentRangeOfNode(root);
     q.push({root, *(rootComps.begin())});
 
     topOrder.reserve(bcc.numberOfComponents());
@@ -198,11 +198,11 @@ void ApproxElectricalCloseness::computeNodeSequence() {
             if (status[v] == NodeStatus::NOT_VISITED) {
                 distance[v] = distance[front.first] + 1;
                 rootEcc = std::max(rootEcc, distance[v]);
-                const auto &vComps = bcc.getComponentsOfNode(v);
+                const auto vComps = bcc.componentRangeOfNode(v);
                 for (const node vComponentIndex : vComps) {
                     // Check if a new biconnected components has been found.
                     if (vComponentIndex != front.second && biAnchor[vComponentIndex] == none
-                        && rootComps.find(vComponentIndex) == rootComps.end()) {
+                        && !rootComps.contains(vComponentIndex)) {
                         // The anchor cannot be the root, because the anchor does not have a parent.
                         // We handle biAnchor = none cases later.
                         biAnchor[vComponentIndex] = (v == root) ? none : v;
@@ -273,8 +273,7 @@ void ApproxElectricalCloseness::sampleUST() {
         // parent component.
         auto updateParentOfAnchor = [&]() -> void {
             for (const node v : G.neighborRange(curAnchor)) {
-                const auto &vComps = bccPtr->getComponentsOfNode(v);
-                if (vComps.find(biParent[componentIndex]) != vComps.end()) {
+                if (bccPtr->componentRangeOfNode(v).contains(biParent[componentIndex])) {
                     parent[curAnchor] = v;
                     break;
                 }
@@ -20,7 +20,6 @@ CoreDecomposition::CoreDecomposition(const Graph& G, bool normalized, bool enfor
         storeNodeOrder(storeNodeOrder)
 {
     if (G.numberOfSelfLoops()) throw std::runtime_error("Core Decomposition implementation does not support graphs with self-loops. Call Graph.removeSelfLoops() first.");
-    if (storeNodeOrder) this->enforceBucketQueueAlgorithm = true;
     canRunInParallel = (! enforceBucketQueueAlgorithm && (G.numberOfNodes() == G.upperNodeIdBound()));
 }
 
@@ -43,9 +42,27 @@ void CoreDecomposition::run() {
     }
 }
 
+count CoreDecomposition::restrictedDegree(node u) const {
+    // Directed graphs are decomposed by the sum of in- and out-degree
+    if (!subsets)
+        return G.isDirected() ? G.degreeOut(u) + G.degreeIn(u) : G.degree(u);
+    count deg = 0;
+    auto countNeighbor = [&](node v) {
+        if (subsets->inSameSubset(u, v))
+            ++deg;
+    };
+    G.forNeighborsOf(u, countNeighbor);
+    if (G.isDirected())
+        G.forInNeighborsOf(u, countNeighbor);
+    return deg;
+}
+
 void CoreDecomposition::runWithParK() {
     count z = G.upperNodeIdBound();
     scoreData.resize(z); // TODO: move to base class
+    nodeOrder.clear();
+    if (storeNodeOrder)
+        nodeOrder.reserve(G.numberOfNodes());
 
     count nUnprocessed = G.numberOfNodes();
     std::vector<node> curr; // currently processed nodes
@@ -57,7 +74,7 @@ void CoreDecomposition::runWithParK() {
     // fill in degrees
     std::vector<count> degrees(z);
     G.parallelForNodes([&](node u) {
-        degrees[u] = G.degree(u);
+        degrees[u] = restrictedDegree(u);
         active[u] = 1;
     });
 
@@ -75,6 +92,9 @@ void CoreDecomposition::runWithParK() {
         size = curr.size();
         while (size > 0) {
             nUnprocessed -= size;
+            // nodes of the same sublevel have at most level unprocessed neighbors each
+            if (storeNodeOrder)
+                nodeOrder.insert(nodeOrder.end(), curr.begin(), curr.end());
 #ifndef NETWORKIT_OMP2
             if (! canRunInParallel || size <= 256) {
                 processSublevel(level, degrees, curr, next);
@@ -134,7 +154,7 @@ void CoreDecomposition::processSublevel(index level,
     for (auto u: curr) {
         scoreData[u] = level;
         G.forNeighborsOf(u, [&](node v) {
-            if (degrees[v] > level) {
+            if (degrees[v] > level && countsEdge(u, v)) {
                 degrees[v]--;
                 if (degrees[v] == level) {
                     next.push_back(v);
@@ -161,7 +181,7 @@ void CoreDecomposition::processSublevelParallel(index level,
         active[u] = 0;
         scoreData[u] = level;
         G.forNeighborsOf(u, [&](node v) {
-            if (degrees[v] > level) {
+            if (degrees[v] > level && countsEdge(u, v)) {
                 index tmp;
 
 #pragma omp atomic capture
@@ -194,12 +214,7 @@ void CoreDecomposition::runWithBucketQueues() {
     /* Bucket sort  by degree */
     /* 1) bucket sizes */
     G.forNodes([&](node u) {
-        count deg = G.degree(u);
-
-        if (directed) {
-            deg += G.degreeIn(u);
-        }
-
+        count deg = restrictedDegree(u);
         degree[u] = deg;
         ++degreeBegin[deg];
     });
@@ -240,7 +255,7 @@ void CoreDecomposition::runWithBucketQueues() {
 
         /* Remove a neighbor by decreasing its degree and changing its position in the queue */
         auto removeNeighbor = [&](node v) {
-            if (nodePtr[v] > i) { // only nodes that are after the current node need to be considered
+            if (nodePtr[v] > i && countsEdge(u, v)) { // only nodes that are after the current node need to be considered
                 // adjust the degree
                 count oldDeg = degree[v];
                 --degree[v];
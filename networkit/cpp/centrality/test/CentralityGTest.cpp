@@ -1130,6 +1130,28 @@ TEST_F(CentralityGTest, testCoreDecompositionDirected) {
     EXPECT_EQ(2u, coreness[15]) << "expected coreness";
 }
 
+TEST_F(CentralityGTest, testCoreDecompositionDirectedRestricted) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(300, 0.03, true).generate();
+    Partition p(G.upperNodeIdBound());
+    p.setUpperBound(2);
+    G.forNodes([&](node u) { p.addToSubset(Aux::Random::integer(1), u); });
+
+    // Restricting must give the cores of the graph without the edges between subsets
+    Graph H(G.upperNodeIdBound(), false, true);
+    G.forEdges([&](node u, node v) {
+        if (p.inSameSubset(u, v))
+            H.addEdge(u, v);
+    });
+    CoreDecomposition expected(H);
+    expected.run();
+
+    CoreDecomposition restricted(G);
+    restricted.restrictToSubsets(p);
+    restricted.run();
+    EXPECT_EQ(restricted.scores(), expected.scores());
+}
+
 TEST_F(CentralityGTest, testLocalClusteringCoefficientUndirected) {
     count n = 16;
     Graph G(n, false, false);
@@ -6,14 +6,28 @@
  * 		 Author: Eugenio Angriman
  */
 
-#include <cmath>
-#include <stack>
+#include <algorithm>
+#include <omp.h>
 
 #include <networkit/components/BiconnectedComponents.hpp>
+#include <networkit/components/ConnectedComponents.hpp>
 
 namespace NetworKit {
 
-BiconnectedComponents::BiconnectedComponents(const Graph &G) : G(&G) {
+struct BiconnectedComponents::Search {
+  std::vector<std::pair<node, Graph::NeighborIterator>> stack;
+  std::vector<std::pair<node, node>> edgeStack;
+  count idx = 0;
+
+  // Components found by this search, in CSR format
+  std::vector<index> offsets{0};
+  std::vector<node> nodes;
+
+  count numberOfComponents() const { return offsets.size() - 1; }
+};
+
+BiconnectedComponents::BiconnectedComponents(const Graph &G, bool parallel)
+    : G(&G), parallel(parallel) {
   if (G.isDirected()) {
     throw std::runtime_error(
         "Error, biconnected components cannot be computed on directed graphs.");
@@ -21,103 +35,150 @@ BiconnectedComponents::BiconnectedComponents(const Graph &G) : G(&G) {
 }
 
 void BiconnectedComponents::init() {
-  n = G->numberOfNodes();
-  idx = 0;
+  const count z = G->upperNodeIdBound();
   nComp = 0;
-  level.assign(n, 0);
-  lowpt.assign(n, 0);
-  parent.assign(n, 0);
-  visited.assign(n, false);
-  isRoot.assign(n, false);
-  componentsOfNode.clear();
-  componentsOfNode.resize(n);
+  level.assign(z, none);
+  lowpt.assign(z, none);
+  parent.assign(z, none);
+  lastComponent.assign(z, none);
+  componentOffsets.assign(1, 0);
+  componentNodes.clear();
 }
 
 void BiconnectedComponents::run() {
 
   init();
 
-  auto visitNode = [&](node u) {
-    level[u] = idx;
-    lowpt[u] = idx;
-    ++idx;
-    visited[u] = true;
-  };
-
-  std::stack<std::pair<node, Graph::NeighborIterator>> stack;
-  std::vector<std::pair<node, node>> edgeStack;
-  G->forNodes([&](node v) {
-    if (visited[v]) {
-      return;
+  if (!parallel) {
+    Search search;
+    G->forNodes([&](node v) {
+      if (level[v] == none)
+        searchFrom(v, search);
+    });
+    componentOffsets = std::move(search.offsets);
+    componentNodes = std::move(search.nodes);
+  } else {
+    // The connected components are independent; searching them from their smallest node
+    // in increasing order gives the sequential result
+    ConnectedComponents cc(*G);
+    cc.run();
+    std::vector<node> roots(cc.numberOfComponents(), none);
+    G->forNodes([&](node u) {
+      node &root = roots[cc.componentOfNode(u)];
+      if (root == none)
+        root = u;
+    });
+    std::sort(roots.begin(), roots.end());
+
+    // Per root: the searching thread and the range of its components found there
+    std::vector<Search> searches(omp_get_max_threads());
+    std::vector<std::pair<index, std::pair<index, index>>> found(roots.size());
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (omp_index i = 0; i < static_cast<omp_index>(roots.size()); ++i) {
+      const index thread = omp_get_thread_num();
+      auto &search = searches[thread];
+      const index first = search.numberOfComponents();
+      searchFrom(roots[i], search);
+      found[i] = {thread, {first, search.numberOfComponents()}};
     }
 
-    isRoot[v] = true;
-    stack.push(std::make_pair(v, G->neighborRange(v).begin()));
-
-    do {
-      node u = stack.top().first;
-      auto &iter = stack.top().second;
-      if (!visited[u]) {
-        visitNode(u);
+    for (const auto &range : found) {
+      const auto &search = searches[range.first];
+      for (index c = range.second.first; c < range.second.second; ++c) {
+        componentNodes.insert(componentNodes.end(),
+                              search.nodes.begin() + search.offsets[c],
+                              search.nodes.begin() + search.offsets[c + 1]);
+        componentOffsets.push_back(componentNodes.size());
       }
+    }
+  }
 
-      for (; iter != G->neighborRange(u).end(); ++iter) {
-        node neighbor = *iter;
-        if (!visited[neighbor]) {
-          visitNode(neighbor);
-          parent[neighbor] = u;
-          stack.push(std::make_pair(neighbor, G->neighborRange(neighbor).begin()));
-          edgeStack.emplace_back(u, neighbor);
-          break;
-        } else if (neighbor != parent[u] && level[neighbor] < level[u]) {
-            edgeStack.emplace_back(u, neighbor);
-            lowpt[u] = std::min(lowpt[u], level[neighbor]);
-        }
+  nComp = componentOffsets.size() - 1;
+  buildNodeComponents();
+  hasRun = true;
+}
+
+void BiconnectedComponents::searchFrom(node root, Search &search) {
+  auto &stack = search.stack;
+  auto &edgeStack = search.edgeStack;
+
+  level[root] = lowpt[root] = search.idx++;
+  stack.emplace_back(root, G->neighborRange(root).begin());
+
+  while (!stack.empty()) {
+    const node u = stack.back().first;
+    auto iter = stack.back().second;
+    const auto end = G->neighborRange(u).end();
+
+    node child = none;
+    for (; iter != end; ++iter) {
+      const node neighbor = *iter;
+      if (level[neighbor] == none) {
+        child = neighbor;
+        ++iter;
+        break;
+      } else if (neighbor != parent[u] && level[neighbor] < level[u]) {
+        edgeStack.emplace_back(u, neighbor);
+        lowpt[u] = std::min(lowpt[u], level[neighbor]);
       }
+    }
 
-      if (iter == G->neighborRange(u).end()) {
-        stack.pop();
+    if (child != none) {
+      stack.back().second = iter;
+      level[child] = lowpt[child] = search.idx++;
+      parent[child] = u;
+      edgeStack.emplace_back(u, child);
+      stack.emplace_back(child, G->neighborRange(child).begin());
+      continue;
+    }
 
-        if (isRoot[u]) {
-          continue;
-        }
+    stack.pop_back();
+    if (u == root) {
+      continue;
+    }
 
-        node v = parent[u];
-        lowpt[v] = std::min(lowpt[v], lowpt[u]);
-        if (lowpt[u] >= level[v]) {
-          auto top = edgeStack.back();
-          componentSizes.insert(std::make_pair(nComp, 0));
-          while (level[top.first] >= level[u]) {
-            edgeStack.pop_back();
-            newComponent(top);
-            top = edgeStack.back();
-          }
-
-          for (auto rit = edgeStack.rbegin(); rit != edgeStack.rend(); ++rit) {
-            if ((*rit).first == v && (*rit).second == u) {
-              newComponent(*rit);
-              edgeStack.erase(std::next(rit).base());
-              break;
-            }
-          }
-          ++nComp;
+    const node v = parent[u];
+    lowpt[v] = std::min(lowpt[v], lowpt[u]);
+    if (lowpt[u] >= level[v]) {
+      // The edges up to the tree edge (v, u) form a new component
+      const index c = search.numberOfComponents();
+      auto addNode = [&](node x) {
+        if (lastComponent[x] != c) {
+          lastComponent[x] = c;
+          search.nodes.push_back(x);
         }
-      }
-    } while (!stack.empty());
-
-    edgeStack.clear();
-  });
-
-  hasRun = true;
+      };
+
+      std::pair<node, node> e;
+      do {
+        e = edgeStack.back();
+        edgeStack.pop_back();
+        addNode(e.first);
+        addNode(e.second);
+      } while (e.first != v || e.second != u);
+      search.offsets.push_back(search.nodes.size());
+    }
+  }
 }
 
-void BiconnectedComponents::newComponent(std::pair<node, node> e) {
-  node u = e.first;
-  node v = e.second;
-  count prevSize = componentsOfNode[u].size() + componentsOfNode[v].size();
-  componentsOfNode[u].insert(nComp);
-  componentsOfNode[v].insert(nComp);
-  componentSizes[nComp] +=
-      componentsOfNode[u].size() + componentsOfNode[v].size() - prevSize;
+void BiconnectedComponents::buildNodeComponents() {
+  const count z = G->upperNodeIdBound();
+  nodeComponentOffsets.assign(z + 1, 0);
+  for (auto u : componentNodes)
+    ++nodeComponentOffsets[u + 1];
+
+  articulationPoints.clear();
+  for (node u = 0; u < z; ++u) {
+    if (nodeComponentOffsets[u + 1] > 1)
+      articulationPoints.push_back(u);
+    nodeComponentOffsets[u + 1] += nodeComponentOffsets[u];
+  }
+
+  nodeComponents.resize(componentNodes.size());
+  std::vector<index> next(nodeComponentOffsets.begin(), nodeComponentOffsets.end() - 1);
+  for (index c = 0; c < nComp; ++c)
+    for (index i = componentOffsets[c]; i < componentOffsets[c + 1]; ++i)
+      nodeComponents[next[componentNodes[i]]++] = c;
 }
 } // namespace NetworKit
@@ -6,6 +6,9 @@
  *     Author: Eugenio Angriman
  */
 
+#include <algorithm>
+#include <set>
+
 #include <gtest/gtest.h>
 
 #include <networkit/auxiliary/Log.hpp>
@@ -35,6 +38,50 @@ TEST_F(BiconnectedComponentsGTest, testBiconnectedComponentsTiny) {
     bc.run();
 
     EXPECT_EQ(bc.numberOfComponents(), 4);
+    EXPECT_EQ(bc.getArticulationPoints(), std::vector<node>({0, 1, 6}));
+    EXPECT_EQ(bc.getComponentsOfNode(0).size(), 2);
+    EXPECT_EQ(bc.getComponentsOfNode(1).size(), 2);
+    EXPECT_EQ(bc.getComponentsOfNode(4).size(), 1);
+
+    std::multiset<std::set<node>> components;
+    for (const auto &component : bc.getComponents())
+        components.emplace(component.begin(), component.end());
+    EXPECT_EQ(components, std::multiset<std::set<node>>(
+                              {{1, 2, 3}, {0, 1, 4, 5}, {0, 6}, {6, 7, 8}}));
+
+    count total = 0;
+    for (const auto &size : bc.getComponentSizes())
+        total += size.second;
+    EXPECT_EQ(total, bc.getComponentNodes().size());
+    EXPECT_EQ(bc.getComponentOffsets().back(), total);
+}
+
+TEST_F(BiconnectedComponentsGTest, testBiconnectedComponentsParallel) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(500, 0.004, false).generate();
+    // Deleted nodes must not shift the node ids
+    for (node u = 0; u < G.upperNodeIdBound(); u += 7)
+        G.removeNode(u);
+
+    BiconnectedComponents sequential(G);
+    sequential.run();
+    BiconnectedComponents parallel(G, true);
+    parallel.run();
+
+    EXPECT_GT(sequential.numberOfComponents(), 1);
+    EXPECT_EQ(sequential.getComponents(), parallel.getComponents());
+    EXPECT_EQ(sequential.getArticulationPoints(), parallel.getArticulationPoints());
+
+    G.forNodes([&](node u) {
+        const auto components = sequential.getComponentsOfNode(u);
+        EXPECT_EQ(components.size() > 1,
+                  std::binary_search(sequential.getArticulationPoints().begin(),
+                                     sequential.getArticulationPoints().end(), u));
+        for (auto c : components) {
+            const auto component = sequential.getComponents()[c];
+            EXPECT_NE(std::find(component.begin(), component.end(), u), component.end());
+        }
+    });
 }
 
 TEST_F(BiconnectedComponentsGTest, testBiconnectedComponents) {
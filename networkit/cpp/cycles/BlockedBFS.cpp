@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <limits>
+
+#include <networkit/cycles/BlockedBFS.hpp>
+
+namespace NetworKit {
+
+BlockedBFS::BlockedBFS(count upperNodeIdBound)
+    : timestamp(upperNodeIdBound, 0), parent(upperNodeIdBound, none),
+      distance(upperNodeIdBound, 0), queue(upperNodeIdBound, none) {}
+
+void BlockedBFS::prepare(const Graph &G, node source) {
+    const count z = G.upperNodeIdBound();
+    if (timestamp.size() < z) {
+        timestamp.resize(z, 0);
+        parent.resize(z, none);
+        distance.resize(z, 0);
+        queue.resize(z, none);
+    }
+
+    ts += 2;
+    if (ts >= std::numeric_limits<uint32_t>::max() - 1) {
+        ts = 2;
+        std::fill(timestamp.begin(), timestamp.end(), 0);
+    }
+
+    this->source = source;
+    neighborQueries = 0;
+    queueEnd = 0;
+
+    queue[queueEnd++] = source;
+    timestamp[source] = ts;
+    parent[source] = none;
+    distance[source] = 0;
+}
+
+bool BlockedBFS::run(const Graph &G, node source, const std::vector<count> *blocked,
+                     node target, count maxDistance) {
+    assert(!blocked || (*blocked)[source] == 0);
+    assert(target == none || !blocked || (*blocked)[target] == 0);
+
+    prepare(G, source);
+    index queueBegin = 0;
+
+    while (queueBegin < queueEnd) {
+        const node u = queue[queueBegin++];
+        if (u == target)
+            return true;
+        if (distance[u] == maxDistance)
+            continue;
+
+        for (node v : G.neighborRange(u)) {
+            ++neighborQueries;
+            if ((blocked && (*blocked)[v] > 0) || timestamp[v] == ts)
+                continue;
+            timestamp[v] = ts;
+            parent[v] = u;
+            distance[v] = distance[u] + 1;
+            queue[queueEnd++] = v;
+        }
+    }
+
+    return target != none && isReached(target);
+}
+
+bool BlockedBFS::runBidirectional(const Graph &G, node source, node target,
+                                  const std::vector<count> *blocked) {
+    assert(!blocked || (*blocked)[source] == 0);
+    assert(!blocked || (*blocked)[target] == 0);
+
+    prepare(G, source);
+    if (source == target)
+        return true;
+
+    index targetQueueEnd = queue.size();
+    queue[--targetQueueEnd] = target;
+    timestamp[target] = ts + 1;
+    parent[target] = none;
+    distance[target] = 0;
+
+    // Pending nodes of the source side are queue[sourceBegin, queueEnd), those of the
+    // target side are queue[targetQueueEnd, targetBegin)
+    index sourceBegin = 0;
+    index targetBegin = queue.size();
+    node meetSource = none, meetTarget = none;
+
+    // Expands all pending nodes of one side by one level; stops as soon as the balls meet
+    auto expand = [&](bool fromSource) {
+        const uint32_t own = fromSource ? ts : ts + 1;
+        const index levelBegin = fromSource ? sourceBegin : targetQueueEnd;
+        const index levelEnd = fromSource ? queueEnd : targetBegin;
+        for (index i = levelBegin; i < levelEnd; ++i) {
+            const node u = queue[i];
+            for (node v : G.neighborRange(u)) {
+                ++neighborQueries;
+                if ((blocked && (*blocked)[v] > 0) || timestamp[v] == own)
+                    continue;
+                if (timestamp[v] == (fromSource ? ts + 1 : ts)) {
+                    // Balls met
+                    meetSource = fromSource ? u : v;
+                    meetTarget = fromSource ? v : u;
+                    return;
+                }
+                timestamp[v] = own;
+                parent[v] = u;
+                distance[v] = distance[u] + 1;
+                if (fromSource)
+                    queue[queueEnd++] = v;
+                else
+                    queue[--targetQueueEnd] = v;
+            }
+        }
+        if (fromSource)
+            sourceBegin = levelEnd;
+        else
+            targetBegin = levelBegin;
+    };
+
+    while (meetSource == none && sourceBegin < queueEnd && targetQueueEnd < targetBegin) {
+        if (queueEnd - sourceBegin <= targetBegin - targetQueueEnd)
+            expand(true);
+        else
+            expand(false);
+    }
+
+    if (meetSource == none)
+        return false;
+
+    // Reverse the parents on the target side such that they lead to the source
+    node previous = meetSource;
+    for (node v = meetTarget; v != none;) {
+        const node next = parent[v];
+        timestamp[v] = ts;
+        parent[v] = previous;
+        distance[v] = distance[previous] + 1;
+        previous = v;
+        v = next;
+    }
+
+    return true;
+}
+
+std::vector<node> BlockedBFS::getPath(node t, bool forward) const {
+    std::vector<node> path;
+    if (!isReached(t) || t == source)
+        return path;
+
+    for (node v = t; v != none; v = parent[v])
+        path.push_back(v);
+
+    if (forward)
+        std::reverse(path.begin(), path.end());
+    return path;
+}
+
+} // namespace NetworKit
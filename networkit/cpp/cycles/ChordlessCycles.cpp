@@ -1,15 +1,19 @@
 // no-networkit-format
+#include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <utility>
 
+#include "networkit/auxiliary/Timer.hpp"
 #include "networkit/components/BiconnectedComponents.hpp"
 #include "networkit/cycles/ChordlessCycles.hpp"
-#include "networkit/distance/BFS.hpp"
 
 namespace NetworKit {
 
 ChordlessCycles::ChordlessCycles(const Graph &G, unsigned int num_max_cycles_, bool constructive_)
-    : G(&G), G_copy(G), num_max_cyles(num_max_cycles_), constructive(constructive_) {
+    : G(&G), num_max_cyles(num_max_cycles_), constructive(constructive_),
+      blockedBFS(G.upperNodeIdBound()) {
     for (auto v : G.nodeRange()) {
         node_order.push_back(v);
     }
@@ -17,98 +21,248 @@ ChordlessCycles::ChordlessCycles(const Graph &G, unsigned int num_max_cycles_, b
 
 ChordlessCycles::ChordlessCycles(const Graph &G, const std::vector<node> &node_order,
                                  unsigned int num_max_cycles_, bool constructive_)
-    : G(&G), G_copy(G), node_order(node_order), num_max_cyles(num_max_cycles_),
-      constructive(constructive_) {}
+    : G(&G), node_order(node_order), num_max_cyles(num_max_cycles_),
+      constructive(constructive_), blockedBFS(G.upperNodeIdBound()) {}
 
 ChordlessCycles::ChordlessCycles(const Graph &G,
                                  std::function<bool(const std::vector<node> &)> callback,
                                  const std::vector<node> &node_order, unsigned int num_max_cycles_,
                                  bool constructive_)
-    : G(&G), callback(std::move(callback)), G_copy(G), node_order(node_order),
-      num_max_cyles(num_max_cycles_), constructive(constructive_) {}
+    : G(&G), callback(std::move(callback)), node_order(node_order),
+      num_max_cyles(num_max_cycles_), constructive(constructive_),
+      blockedBFS(G.upperNodeIdBound()) {}
 
 const std::vector<std::vector<node>> &ChordlessCycles::ChordlessCycles::getChordlessCycles() const {
     if (callback)
         throw std::runtime_error(
             "ChordlessCycles used with callback does not store chordless cycles");
+    if (compactStorage || !outputFile.empty() || countOnly)
+        throw std::runtime_error("ChordlessCycles used with compact storage, output file or "
+                                 "counting only does not return vectors");
     assureFinished();
     return result;
 }
 
+void ChordlessCycles::setCompactStorage(bool compressed) {
+    compactStorage = true;
+    cycleStore = CycleStore(compressed);
+    outputFile.clear();
+    countOnly = false;
+}
+
+void ChordlessCycles::setOutputFile(const std::string &path, count chunkSize) {
+    outputFile = path;
+    outputChunkSize = chunkSize;
+    compactStorage = false;
+    countOnly = false;
+}
+
+void ChordlessCycles::setCountingOnly() {
+    countOnly = true;
+    compactStorage = false;
+    outputFile.clear();
+}
+
+void ChordlessCycles::setCheckpointFile(const std::string &path, double intervalSeconds) {
+    checkpointFile = path;
+    checkpointInterval = intervalSeconds;
+}
+
+void ChordlessCycles::resumeFrom(const std::string &path) {
+    // The callback saw cycles of the outer loop that the resumed run repeats
+    if (callback)
+        throw std::runtime_error("Error: enumerations with a callback cannot be resumed");
+    resumeFile = path;
+}
+
+const CycleStore &ChordlessCycles::getCycleStore() const {
+    if (!compactStorage || callback)
+        throw std::runtime_error("ChordlessCycles used without compact storage");
+    assureFinished();
+    return cycleStore;
+}
+
+const std::vector<count> &ChordlessCycles::getLengthHistogram() const {
+    if (callback)
+        throw std::runtime_error("ChordlessCycles used with callback does not count lengths");
+    assureFinished();
+    return lengthHistogram;
+}
+
+count ChordlessCycles::numberOfCycles() const {
+    assureFinished();
+    return numFoundCycles;
+}
+
+bool ChordlessCycles::stoppedEarly() const {
+    assureFinished();
+    return stopped;
+}
+
+void ChordlessCycles::reportCycle(const std::vector<node> &cycle) {
+    // Parallel workers may find cycles beyond the limit before they notice the stop. Without
+    // a limit, they only count their own cycles, which are added up after the run.
+    const count total =
+        sharedNumFound && hasCycleLimit() ? ++*sharedNumFound : numFoundCycles + 1;
+    if (total > num_max_cyles) {
+        stop();
+        return;
+    }
+
+    numFoundCycles += 1;
+    if (cycle.size() >= lengthHistogram.size())
+        lengthHistogram.resize(cycle.size() + 1, 0);
+    lengthHistogram[cycle.size()] += 1;
+
+    bool goOn = true;
+    if (callback) {
+        goOn = callback(cycle);
+    } else if (!countOnly) {
+        if (outputStream)
+            outputStream->add(cycle);
+        else if (compactStorage)
+            cycleStore.add(cycle);
+        else
+            result.push_back(cycle);
+    }
+
+    if (!goOn || total >= num_max_cyles)
+        stop();
+}
+
+bool ChordlessCycles::isStopped() {
+    if (!stopped
+        && ((sharedStop && sharedStop->load(std::memory_order_relaxed))
+            || (signalHandler && !signalHandler->isRunning())))
+        stopped = true;
+    return stopped;
+}
+
+void ChordlessCycles::stop() {
+    stopped = true;
+    if (sharedStop)
+        sharedStop->store(true, std::memory_order_relaxed);
+}
+
+void ChordlessCycles::addCounts(const ChordlessCycles &other) {
+    numFoundCycles += other.numFoundCycles;
+    if (other.lengthHistogram.size() > lengthHistogram.size())
+        lengthHistogram.resize(other.lengthHistogram.size(), 0);
+    for (index i = 0; i < other.lengthHistogram.size(); ++i)
+        lengthHistogram[i] += other.lengthHistogram[i];
+}
+
+void ChordlessCycles::openOutput() {
+    numFoundCycles = resumed.numFound;
+    lengthHistogram = resumed.lengthHistogram;
+    stopped = numFoundCycles >= num_max_cyles;
+    cycleStore.clear();
+    if (outputFile.empty() || callback)
+        return;
+    if (resumed.position == 0)
+        outputStream.reset(new CycleStreamWriter(outputFile, outputChunkSize));
+    else if (resumed.outputSize > 0)
+        outputStream.reset(new CycleStreamWriter(outputFile, outputChunkSize,
+                                                 resumed.outputSize, numFoundCycles));
+    else
+        throw std::runtime_error("Error: the checkpoint was saved without an output file");
+}
+
+void ChordlessCycles::closeOutput() {
+    if (!outputStream)
+        return;
+    // Writes the last chunk here, as the destructor of the writer cannot report errors
+    std::unique_ptr<CycleStreamWriter> stream(std::move(outputStream));
+    stream->flush();
+}
+
+bool ChordlessCycles::bfsTarget(const Graph &g, node start, node target,
+                                const std::vector<count> *blocked) {
+    if (!bidirectional) {
+        bool reached = timeBfs([&] { return blockedBFS.run(g, start, blocked, target); });
+        metrics.bfsNeighborQueries += blockedBFS.getNeighborQueries();
+        return reached;
+    }
+
+    count unidirectionalQueries = 0;
+    const bool sampled = metrics.bidirectionalBfsCalls % ChordlessCyclesMetrics::sampleInterval == 0;
+    if (sampled) {
+        blockedBFS.run(g, start, blocked, target);
+        unidirectionalQueries = blockedBFS.getNeighborQueries();
+    }
+
+    metrics.bidirectionalBfsCalls += 1;
+    bool reached =
+        timeBfs([&] { return blockedBFS.runBidirectional(g, start, target, blocked); });
+    metrics.bfsNeighborQueries += blockedBFS.getNeighborQueries();
+
+    if (sampled) {
+        metrics.sampledBfsCalls += 1;
+        metrics.sampledUnidirectionalQueries += unidirectionalQueries;
+        metrics.sampledBidirectionalQueries += blockedBFS.getNeighborQueries();
+    }
+    return reached;
+}
+
 bool ChordlessCycles::bfsReachable(const Graph &g, node start, node target) {
-    bfsCalls += 1;
-    auto bfs = NetworKit::BFS(g, start, false, false, target);
-    bfs.run();
-    bfsNeighborQueries += bfs.neighborQueries;
-    return (int)bfs.distance(target) < g.numberOfNodes();
+    metrics.bfsCalls += 1;
+    return bfsTarget(g, start, target, nullptr);
+}
+
+bool ChordlessCycles::bfsReachable(const Graph &g, node start, node target,
+                                   const std::vector<count> &blocked) {
+    metrics.bfsCalls += 1;
+    if (blocked[target] > 0)
+        return false;
+    return bfsTarget(g, start, target, &blocked);
 }
 
 std::vector<node> ChordlessCycles::allBfsReachable(const Graph &g, node start,
                                                    const std::vector<count> &blocked) {
-    bfsCalls += 1;
-    auto bfs = NetworKit::BFS(g, start, blocked, true, false);
-    bfs.run();
-    bfsNeighborQueries += bfs.neighborQueries;
+    metrics.bfsCalls += 1;
+    timeBfs([&] { return blockedBFS.run(g, start, &blocked); });
+    metrics.bfsNeighborQueries += blockedBFS.getNeighborQueries();
 
-    auto allDistances = bfs.getDistances();
     auto reachableNodes = std::vector<node>();
-    uint num_nodes = g.numberOfNodes();
-    for (auto curNode : g.nodeRange()) {
-        if (allDistances[curNode] < num_nodes) {
-            reachableNodes.push_back(curNode);
-        }
-    }
+    reachableNodes.reserve(blockedBFS.numberOfReachedNodes());
+    blockedBFS.forReachedNodes([&](node u) { reachableNodes.push_back(u); });
     return reachableNodes;
 }
 
 std::vector<bool> ChordlessCycles::bfsReachableMask(const Graph &g, node start) {
-    bfsCalls += 1;
-    auto bfs = NetworKit::BFS(g, start, false, false);
-    bfs.run();
-    bfsNeighborQueries += bfs.neighborQueries;
-
-    auto allDistances = bfs.getDistances();
-    auto reachableMask = std::vector<bool>(allDistances.size(), false);
-    uint num_nodes = g.numberOfNodes();
-    for (auto curNode : g.nodeRange()) {
-        reachableMask[curNode] = allDistances[curNode] < num_nodes;
-    }
+    metrics.bfsCalls += 1;
+    timeBfs([&] { return blockedBFS.run(g, start); });
+    metrics.bfsNeighborQueries += blockedBFS.getNeighborQueries();
 
+    auto reachableMask = std::vector<bool>(g.upperNodeIdBound(), false);
+    blockedBFS.forReachedNodes([&](node u) { reachableMask[u] = true; });
     return reachableMask;
 }
 
 std::vector<bool> ChordlessCycles::bfsReachableMask(const Graph &g, node start,
                                                     const std::vector<count> &blocked) {
-    bfsCalls += 1;
-    auto bfs = NetworKit::BFS(g, start, blocked, true, false);
-    bfs.run();
-    bfsNeighborQueries += bfs.neighborQueries;
-
-    auto allDistances = bfs.getDistances();
-    auto reachableMask = std::vector<bool>(allDistances.size(), false);
-    uint num_nodes = g.numberOfNodes();
-    for (auto curNode : g.nodeRange()) {
-        reachableMask[curNode] = allDistances[curNode] < num_nodes;
-    }
+    metrics.bfsCalls += 1;
+    timeBfs([&] { return blockedBFS.run(g, start, &blocked); });
+    metrics.bfsNeighborQueries += blockedBFS.getNeighborQueries();
 
+    auto reachableMask = std::vector<bool>(g.upperNodeIdBound(), false);
+    blockedBFS.forReachedNodes([&](node u) { reachableMask[u] = true; });
     return reachableMask;
 }
 
 std::vector<node> ChordlessCycles::bfsPaths(const Graph &g, node start, node target, bool forward) {
-    bfsCalls += 1;
-    auto bfs = NetworKit::BFS(g, start, true, false, target);
-    bfs.run();
-    bfsNeighborQueries += bfs.neighborQueries;
-    return bfs.getPath(target, forward);
+    metrics.bfsCalls += 1;
+    bfsTarget(g, start, target, nullptr);
+    return blockedBFS.getPath(target, forward);
 }
 
 std::vector<node> ChordlessCycles::bfsPaths(const Graph &g, node start, node target,
                                             const std::vector<count> &blocked, bool forward) {
-    bfsCalls += 1;
-    auto bfs = NetworKit::BFS(g, start, blocked, true, false, target);
-    bfs.run();
-    bfsNeighborQueries += bfs.neighborQueries;
-    return bfs.getPath(target, forward);
+    metrics.bfsCalls += 1;
+    if (blocked[target] > 0)
+        return {};
+    bfsTarget(g, start, target, &blocked);
+    return blockedBFS.getPath(target, forward);
 }
 
 void ChordlessCycles::reset() {
@@ -116,131 +270,278 @@ void ChordlessCycles::reset() {
     result.clear();
 
     G_copy = Graph(*G);
-    num_tree_nodes = 0;
-    num_leafs = 0;
+    metrics = ChordlessCyclesMetrics();
 }
 
 void ChordlessCycles::run() {
+    // Ctrl-C stops the enumeration, keeping the cycles found so far
+    Aux::SignalHandler handler;
+    signalHandler = &handler;
+
+    Aux::StartedTimer timer;
     reset();
+    loadCheckpoint();
+    resumeFile.clear();
+    openOutput();
+    metrics.preprocessingSeconds = timer.elapsedNanoseconds() * 1e-9;
+
+    // Variants may decompose the graph or derive orders during the enumeration as well
+    timer.start();
+    const double phasesBefore = metrics.preprocessingSeconds + metrics.orderingSeconds;
     if (constructive) {
         constructiveEnumeration();
     } else {
         destructiveEnumeration();
     }
+    closeOutput();
+    metrics.enumerationSeconds = timer.elapsedNanoseconds() * 1e-9
+                                 - (metrics.preprocessingSeconds + metrics.orderingSeconds
+                                    - phasesBefore);
+    metrics.cycles = numFoundCycles;
+    signalHandler = nullptr;
     hasRun = true;
-    report();
 }
 
 void ChordlessCycles::destructiveEnumeration() {
-    for (auto u : node_order) {
-        num_outer_loops += 1;
+    std::vector<count> blocked(G->upperNodeIdBound(), 0);
+    // nodes of a resumed run's finished loops are removed already
+    for (index i = 0; i < resumed.position; ++i)
+        blocked[node_order[i]] += 1;
 
-        if (result.size() >= num_max_cyles) {
-            break;
+    enumerateOuterLoops(blocked);
+}
+
+void ChordlessCycles::constructiveEnumeration() {
+    // no node added in the beginning
+    std::vector<count> blocked(G->upperNodeIdBound(), 1);
+    // nodes of a resumed run's finished loops are added already
+    for (index i = 0; i < resumed.position; ++i)
+        blocked[node_order[i]] -= 1;
+
+    enumerateOuterLoops(blocked);
+}
+
+void ChordlessCycles::enumerateOuterLoops(std::vector<count> &blocked) {
+    using clock = std::chrono::steady_clock;
+    const bool checkpointing = !checkpointFile.empty();
+    auto lastCheckpoint = clock::now();
+    Checkpoint boundary;
+
+    for (index position = resumed.position; position < node_order.size(); ++position) {
+        const node u = node_order[position];
+        metrics.outerLoops += 1;
+
+        if (checkpointing) {
+            boundary.position = position;
+            boundary.numFound = numFoundCycles;
+            boundary.lengthHistogram = lengthHistogram;
+            boundary.outputSize = outputStream ? outputStream->size() : 0;
+        }
+
+        if (isStopped()) {
+            if (checkpointing)
+                writeCheckpoint(boundary);
+            return;
         }
 
-        auto currentCopy = Graph(G_copy);
-        for (auto v : G_copy.neighborRange(u)) {
-            num_inner_loops += 1;
-            currentCopy.removeEdge(u, v);
-            std::vector<node> path;
-            path.push_back(u);
-            // biConReport(G_copy);
-            allChordlessPaths(currentCopy, u, v, path);
-            currentCopy.removeNode(v);
+        if (checkpointing
+            && std::chrono::duration<double>(clock::now() - lastCheckpoint).count()
+                   >= checkpointInterval) {
+            writeCheckpoint(boundary);
+            lastCheckpoint = clock::now();
+        }
+
+        if (constructive) {
+            // add node u and available edges, then enum all chordless paths through u
+            blocked[u] -= 1;
+            enumerateCyclesThrough(u, blocked);
+        } else {
+            enumerateCyclesThrough(u, blocked);
+            blocked[u] += 1;
         }
 
-        for (auto w : G_copy.neighborRange(u)) {
-            G_copy.removeEdge(u, w);
+        // The loop may be incomplete, so a resumed run repeats it
+        if (checkpointing && isStopped()) {
+            writeCheckpoint(boundary);
+            return;
         }
     }
+
+    if (checkpointing)
+        writeCheckpoint({node_order.size(), numFoundCycles, lengthHistogram,
+                         outputStream ? outputStream->size() : 0});
 }
 
-void ChordlessCycles::constructiveEnumeration() {
-    G_copy = Graph(G->numberOfNodes());
+uint64_t ChordlessCycles::checkpointFingerprint() const {
+    // FNV-1a of the input that determines the enumeration order
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint64_t x) {
+        for (int i = 0; i < 8; ++i) {
+            hash ^= (x >> (8 * i)) & 0xff;
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(G->numberOfNodes());
+    mix(G->numberOfEdges());
+    mix(constructive);
+    for (auto u : node_order)
+        mix(u);
+
+    // The hashes of the edges are summed, so the order of the adjacency arrays does not matter
+    auto scramble = [](uint64_t x) {
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    };
+    const bool directed = G->isDirected();
+    uint64_t edgeSum = 0;
+    G->forEdges([&](node u, node v) {
+        if (!directed && u > v)
+            std::swap(u, v);
+        edgeSum += scramble(scramble(u) ^ v);
+    });
+    mix(edgeSum);
+    return hash;
+}
 
-    // no node added in the beginning
-    std::vector<bool> added_nodes;
-    added_nodes.reserve(G->numberOfNodes());
-    for (uint i = 0; i < G->numberOfNodes(); i++) {
-        added_nodes.push_back(false);
+void ChordlessCycles::loadCheckpoint() {
+    resumed = Checkpoint();
+    // Hashing the edges takes linear time, so it is done once per run
+    if (!checkpointFile.empty() || !resumeFile.empty())
+        inputFingerprint = checkpointFingerprint();
+    if (resumeFile.empty())
+        return;
+
+    std::ifstream in(resumeFile);
+    std::string magic;
+    uint64_t fingerprint = 0;
+    count histogramSize = 0;
+    in >> magic >> fingerprint >> resumed.position >> resumed.numFound >> resumed.outputSize
+        >> histogramSize;
+    if (!in || magic != "ChordlessCyclesCheckpoint")
+        throw std::runtime_error("Error: " + resumeFile + " is no checkpoint");
+    if (fingerprint != inputFingerprint || resumed.position > node_order.size())
+        throw std::runtime_error("Error: the checkpoint " + resumeFile
+                                 + " belongs to another graph, node order or direction");
+    resumed.lengthHistogram.resize(histogramSize);
+    for (auto &length : resumed.lengthHistogram)
+        in >> length;
+    if (!in)
+        throw std::runtime_error("Error: the checkpoint " + resumeFile + " is truncated");
+}
+
+void ChordlessCycles::writeCheckpoint(const Checkpoint &checkpoint) {
+    // The cycles until the checkpoint must be on disk before it refers to them
+    if (outputStream)
+        outputStream->flush();
+
+    const std::string tmpFile = checkpointFile + ".tmp";
+    {
+        std::ofstream out(tmpFile, std::ios::trunc);
+        out << "ChordlessCyclesCheckpoint " << inputFingerprint << ' '
+            << checkpoint.position << ' ' << checkpoint.numFound << ' '
+            << checkpoint.outputSize << ' ' << checkpoint.lengthHistogram.size();
+        for (auto length : checkpoint.lengthHistogram)
+            out << ' ' << length;
+        out << std::endl;
+        if (!out)
+            throw std::runtime_error("Error: checkpoint " + tmpFile + " couldn't be written");
+    }
+    if (std::rename(tmpFile.c_str(), checkpointFile.c_str()) != 0) {
+        // Windows does not replace existing files
+        std::remove(checkpointFile.c_str());
+        if (std::rename(tmpFile.c_str(), checkpointFile.c_str()) != 0)
+            throw std::runtime_error("Error: checkpoint " + checkpointFile
+                                     + " couldn't be replaced");
     }
+}
 
-    for (auto u : node_order) {
-        num_outer_loops += 1;
+void ChordlessCycles::enumerateCyclesThrough(node u, std::vector<count> &blocked) {
+    std::vector<node> neighbors;
+    for (auto v : G_copy.neighborRange(u)) {
+        if (blocked[v] == 0)
+            neighbors.push_back(v);
+    }
 
-        if (result.size() >= num_max_cyles) {
+    finishedNeighbors.clear();
+    for (auto v : neighbors) {
+        if (isStopped())
             break;
-        }
-
-        // add node u and available edges
-        added_nodes[u] = true;
-        for (auto v : G->neighborRange(u)) {
-            if (added_nodes[v]) {
-                G_copy.addEdge(u, v);
-            }
-        }
+        metrics.innerLoops += 1;
+        G_copy.removeEdge(u, v);
+        std::vector<node> path;
+        path.push_back(u);
+        // biConReport(G_copy);
+        allChordlessPaths(G_copy, u, v, path, blocked);
+        blocked[v] += 1;
+        finishedNeighbors.push_back(v);
+    }
 
-        // enum all chordless paths through u
-        Graph currentCopy = Graph(G_copy);
-        for (auto v : G_copy.neighborRange(u)) {
-            num_inner_loops += 1;
-            currentCopy.removeEdge(u, v);
-            std::vector<node> path;
-            path.push_back(u);
-            // biConReport(G_copy);
-            allChordlessPaths(currentCopy, u, v, path);
-            currentCopy.removeNode(v);
-        }
+    for (auto v : finishedNeighbors) {
+        G_copy.addEdge(u, v);
+        blocked[v] -= 1;
     }
 }
 
 void ChordlessCycles::allChordlessPaths(const Graph &g, node current, node target,
-                                        const std::vector<node> &path) {
-    if (result.size() >= num_max_cyles) {
+                                        const std::vector<node> &path,
+                                        std::vector<count> &blocked) {
+    if (isStopped()) {
         return;
     }
-    num_tree_nodes += 1;
+    metrics.treeNodes += 1;
 
     if (current == target) {
-        if (callback) {
-            callback(path);
-        } else {
-            result.push_back(path);
-        }
-        num_leafs += 1;
+        reportCycle(path);
+        metrics.leafs += 1;
         return;
     }
 
-    if (g.degree(current) == 0)
-        num_leafs += 1;
-
+    bool isLeaf = true;
+    blocked[current] += 1;
     for (auto v : g.neighborRange(current)) {
-        auto current_graph = Graph(g);
-        for (auto u : current_graph.neighborRange(current)) {
-            if (u != v)
-                current_graph.removeNode(u);
-        }
-        current_graph.removeNode(current);
+        if (isStopped())
+            break;
+        if (blocked[v] > 0)
+            continue;
+        isLeaf = false;
 
-        if (bfsReachable(current_graph, v, target)) {
+        // create G \ (N(current) \ v) \ current via blocking
+        blockNeighbors(g, current, blocked, v);
+        if (bfsReachable(g, v, target, blocked)) {
             auto new_path(path);
             new_path.push_back(v);
-            allChordlessPaths(current_graph, v, target, new_path);
+            allChordlessPaths(g, v, target, new_path, blocked);
         }
+        unblockNeighbors(g, current, blocked, v);
+    }
+    blocked[current] -= 1;
+
+    if (isLeaf)
+        metrics.leafs += 1;
+}
+
+void ChordlessCycles::blockNeighbors(const Graph &g, node u, std::vector<count> &blocked,
+                                     node exception) {
+    for (auto v : g.neighborRange(u)) {
+        if (v != exception)
+            blocked[v] += 1;
+    }
+}
+
+void ChordlessCycles::unblockNeighbors(const Graph &g, node u, std::vector<count> &blocked,
+                                       node exception) {
+    for (auto v : g.neighborRange(u)) {
+        if (v != exception)
+            blocked[v] -= 1;
     }
 }
 
-void ChordlessCycles::report() {
-    std::cout << "Num outer loops: " << num_outer_loops << std::endl;
-    std::cout << "Num inner loops: " << num_inner_loops << std::endl;
-    std::cout << "Num tree nodes: " << num_tree_nodes << std::endl;
-    std::cout << "Num leafs: " << num_leafs << std::endl;
-    std::cout << "Num ccs: " << result.size() << std::endl;
-    std::cout << "Num bfs calls: " << bfsCalls << std::endl;
-    std::cout << "Num unsuccessful bfs calls: " << unsuccessfulBfsCalls << std::endl;
-    std::cout << "Num bfs neighbor queries: " << bfsNeighborQueries << std::endl;
+const ChordlessCyclesMetrics &ChordlessCycles::getMetrics() const {
+    assureFinished();
+    return metrics;
 }
+
 void ChordlessCycles::biConReport(const Graph &g) {
     auto bi_c = BiconnectedComponents(g);
     bi_c.run();
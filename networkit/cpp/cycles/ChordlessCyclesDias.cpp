@@ -24,7 +24,10 @@ private:
 public:
     ChordlessCyclesDiasImpl(const NetworKit::Graph &G, std::vector<std::vector<node>> &result,
                             std::function<void(const std::vector<node> &)> &callback)
-        : G(&G), result(&result), callback(callback), G_copy(G) {}
+        : G(&G), result(&result), callback(callback), G_copy(G) {
+        // Sorted for the chord checks of allTriplets()
+        G_copy.setSortedAdjacency();
+    }
 
     void run() { auto triplets = allTriplets(); }
 
@@ -38,7 +41,7 @@ private:
 
             for (auto y : G->neighborRange(u)) {
                 if (x < y) {
-                    if (G->hasEdge(x, y)) {
+                    if (G_copy.hasEdge(x, y)) {
                         // triangle
                         result->push_back(std::vector<node>{x, u, y});
                     } else {
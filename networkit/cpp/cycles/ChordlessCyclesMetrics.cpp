@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <sstream>
+
+#include <networkit/cycles/ChordlessCyclesMetrics.hpp>
+
+namespace NetworKit {
+
+constexpr count ChordlessCyclesMetrics::sampleInterval;
+
+void ChordlessCyclesMetrics::add(const ChordlessCyclesMetrics &other) {
+    outerLoops += other.outerLoops;
+    innerLoops += other.innerLoops;
+    treeNodes += other.treeNodes;
+    leafs += other.leafs;
+    cycles += other.cycles;
+    bfsCalls += other.bfsCalls;
+    unsuccessfulBfsCalls += other.unsuccessfulBfsCalls;
+    bfsNeighborQueries += other.bfsNeighborQueries;
+    bidirectionalBfsCalls += other.bidirectionalBfsCalls;
+    sampledBfsCalls += other.sampledBfsCalls;
+    sampledUnidirectionalQueries += other.sampledUnidirectionalQueries;
+    sampledBidirectionalQueries += other.sampledBidirectionalQueries;
+    timedBfsCalls += other.timedBfsCalls;
+    timedBfsSeconds += other.timedBfsSeconds;
+}
+
+double ChordlessCyclesMetrics::bfsSeconds() const {
+    if (timedBfsCalls == 0)
+        return 0;
+    return timedBfsSeconds / static_cast<double>(timedBfsCalls) * static_cast<double>(bfsCalls);
+}
+
+double ChordlessCyclesMetrics::recursionSeconds() const {
+    return std::max(0., enumerationSeconds * static_cast<double>(threads) - bfsSeconds());
+}
+
+double ChordlessCyclesMetrics::savedBfsNeighborQueries() const {
+    if (sampledBfsCalls == 0)
+        return 0;
+    const double savedPerCall = (static_cast<double>(sampledUnidirectionalQueries)
+                                 - static_cast<double>(sampledBidirectionalQueries))
+                                / static_cast<double>(sampledBfsCalls);
+    return savedPerCall * static_cast<double>(bidirectionalBfsCalls);
+}
+
+std::string ChordlessCyclesMetrics::toJson() const {
+    std::ostringstream os;
+    os << "{\"outerLoops\": " << outerLoops << ", \"innerLoops\": " << innerLoops
+       << ", \"treeNodes\": " << treeNodes << ", \"leafs\": " << leafs
+       << ", \"cycles\": " << cycles << ", \"bfsCalls\": " << bfsCalls
+       << ", \"unsuccessfulBfsCalls\": " << unsuccessfulBfsCalls
+       << ", \"bfsNeighborQueries\": " << bfsNeighborQueries
+       << ", \"bidirectionalBfsCalls\": " << bidirectionalBfsCalls
+       << ", \"savedBfsNeighborQueries\": " << savedBfsNeighborQueries()
+       << ", \"threads\": " << threads << ", \"orderingSeconds\": " << orderingSeconds
+       << ", \"preprocessingSeconds\": " << preprocessingSeconds
+       << ", \"enumerationSeconds\": " << enumerationSeconds
+       << ", \"bfsSeconds\": " << bfsSeconds() << ", \"recursionSeconds\": " << recursionSeconds()
+       << "}";
+    return os.str();
+}
+
+void ChordlessCyclesMetrics::print(std::ostream &os) const {
+    os << "Num outer loops: " << outerLoops << "\n";
+    os << "Num inner loops: " << innerLoops << "\n";
+    os << "Num tree nodes: " << treeNodes << "\n";
+    os << "Num leafs: " << leafs << "\n";
+    os << "Num ccs: " << cycles << "\n";
+    os << "Num bfs calls: " << bfsCalls << "\n";
+    os << "Num unsuccessful bfs calls: " << unsuccessfulBfsCalls << "\n";
+    os << "Num bfs neighbor queries: " << bfsNeighborQueries << "\n";
+    if (bidirectionalBfsCalls > 0) {
+        os << "Num bidirectional bfs calls: " << bidirectionalBfsCalls << "\n";
+        os << "Est. bfs neighbor queries saved: "
+           << static_cast<int64_t>(savedBfsNeighborQueries()) << " (" << sampledBfsCalls
+           << " sampled calls)\n";
+    }
+    os << "Ordering: " << orderingSeconds << " s\n";
+    os << "Preprocessing: " << preprocessingSeconds << " s\n";
+    os << "Enumeration: " << enumerationSeconds << " s on " << threads << " threads\n";
+    os << "Est. bfs: " << bfsSeconds() << " s, recursion: " << recursionSeconds()
+       << " s (thread seconds)" << std::endl;
+}
+
+} // namespace NetworKit
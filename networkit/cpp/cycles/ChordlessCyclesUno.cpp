@@ -1,9 +1,10 @@
 // no-networkit-format
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 
+#include "networkit/auxiliary/Timer.hpp"
 #include "networkit/cycles/ChordlessCyclesUno.hpp"
-#include "networkit/distance/BFS.hpp"
 
 namespace NetworKit {
 
@@ -14,88 +15,65 @@ void ChordlessCyclesUno::reset() {
     result.clear();
 
     G_copy = Graph(*G);
-    num_tree_nodes = 0;
-    num_leafs = 0;
+    metrics = ChordlessCyclesMetrics();
 }
 
 void ChordlessCyclesUno::run() {
+    if (!checkpointFile.empty() || !resumeFile.empty())
+        throw std::runtime_error("Error: ChordlessCyclesUno does not support checkpoints");
+    Aux::SignalHandler handler;
+    signalHandler = &handler;
+
+    Aux::StartedTimer timer;
     reset();
+    openOutput();
+    metrics.preprocessingSeconds = timer.elapsedNanoseconds() * 1e-9;
+
+    timer.start();
     findChordlessCycles();
+    closeOutput();
+    metrics.enumerationSeconds = timer.elapsedNanoseconds() * 1e-9;
+    metrics.cycles = numFoundCycles;
+    signalHandler = nullptr;
     hasRun = true;
-    report();
 }
 
 void ChordlessCyclesUno::findChordlessCycles() { // pick an edge u v
+    std::vector<count> blocked(G->upperNodeIdBound(), 0);
+
     for (auto u : node_order) {
-        if (result.size() >= num_max_cyles) {
+        if (isStopped()) {
             break;
         }
 
-        auto current_copy = Graph(G_copy);
-
+        std::vector<node> neighbors;
         for (auto v : G_copy.neighborRange(u)) {
-            current_copy.removeEdge(u, v);
-            if (bfsReachable(current_copy, u, v)) {
-                chordlessPath(current_copy, u, v);
+            if (blocked[v] == 0)
+                neighbors.push_back(v);
+        }
+
+        for (auto v : neighbors) {
+            G_copy.removeEdge(u, v);
+            if (bfsReachable(G_copy, u, v, blocked)) {
+                chordlessPath(G_copy, u, v, blocked);
             }
-            current_copy.removeNode(v);
+            blocked[v] += 1;
         }
 
-        for (auto w : G_copy.neighborRange(u)) {
-            G_copy.removeEdge(u, w);
+        for (auto v : neighbors) {
+            G_copy.addEdge(u, v);
+            blocked[v] -= 1;
         }
+        blocked[u] += 1;
     }
 }
 
 // Find all chordless paths from u to v
-void ChordlessCyclesUno::chordlessPath(const Graph &g, node u, node v) {
+void ChordlessCyclesUno::chordlessPath(const Graph &g, node u, node v,
+                                       std::vector<count> &blocked) {
     std::vector<node> path;
     path.push_back(v);
-
-    auto bfs = NetworKit::BFS(g, u, true, false, v);
-    bfs.run();
-    auto paths = bfs.getPath(v);
-    if (!paths.empty())
-        findChordlessPath(g, u, v, path);
-}
-
-void ChordlessCyclesUno::findChordlessPath(const Graph &g, node current, node target,
-                                           const std::vector<node> &path) {
-    if (result.size() >= num_max_cyles) {
-        return;
-    }
-    num_tree_nodes += 1;
-
-    if (current == target) {
-        if (callback) {
-            callback(path);
-        } else {
-            result.push_back(path);
-        }
-        num_leafs += 1;
-        return;
-    }
-
-    if (g.degree(current) == 0)
-        num_leafs += 1;
-
-    // pick one neighbor
-    // block all others
-    // go deeper
-    for (auto v : g.neighborRange(current)) {
-        auto current_graph = Graph(g);
-        for (auto u : current_graph.neighborRange(current)) {
-            if (u != v)
-                current_graph.removeNode(u);
-        }
-        current_graph.removeNode(current);
-
-        if (bfsReachable(current_graph, v, target)) {
-            auto new_path(path);
-            new_path.push_back(v);
-            findChordlessPath(current_graph, v, target, new_path);
-        }
-    }
+    allChordlessPaths(g, u, v, path, blocked);
 }
 
 } // namespace NetworKit
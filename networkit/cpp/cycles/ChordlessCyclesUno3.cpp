@@ -11,34 +11,35 @@ void ChordlessCyclesUno3::reset() {
     result.clear();
 
     G_copy = Graph(*G);
-    num_tree_nodes = 0;
-    num_leafs = 0;
+    metrics = ChordlessCyclesMetrics();
 }
 
 void ChordlessCyclesUno3::allChordlessPaths(const Graph &g, node current, node target,
-                                            const std::vector<node> &path) {
-    auto suggestedPathReverse = bfsPaths(g, current, target, false);
+                                            const std::vector<node> &path,
+                                            std::vector<count> &blocked) {
+    auto suggestedPathReverse = bfsPaths(g, current, target, blocked, false);
     if (suggestedPathReverse.empty()) {
-        unsuccessfulBfsCalls += 1;
+        metrics.unsuccessfulBfsCalls += 1;
         return;
     } else {
         // The start node should not be part of the paths to follow
         suggestedPathReverse.pop_back();
-        allChordlessPathsFollow(g, current, target, path, suggestedPathReverse);
+        allChordlessPathsFollow(g, current, target, path, suggestedPathReverse, blocked);
     }
 }
 
 void ChordlessCyclesUno3::allChordlessPathsFollow(const Graph &g, node current, node target,
                                                   const std::vector<node> &path,
-                                                  std::vector<node> &suggestedPathsReverse) {
+                                                  std::vector<node> &suggestedPathsReverse,
+                                                  std::vector<count> &blocked) {
     assert(path.back() == current);
     assert(suggestedPathsReverse.front() == target);
-    assert(g.degree(current) > 0);
+    assert(blocked[current] == 0);
 
-    if (result.size() >= num_max_cyles) {
+    if (isStopped()) {
         return;
     }
-    num_tree_nodes += 1;
+    metrics.treeNodes += 1;
 
     auto nextNode = suggestedPathsReverse.back();
     suggestedPathsReverse.pop_back();
@@ -46,55 +47,49 @@ void ChordlessCyclesUno3::allChordlessPathsFollow(const Graph &g, node current,
     if (suggestedPathsReverse.empty()) {
         auto fullPaths = std::vector<node>(path);
         fullPaths.push_back(nextNode);
-        if (callback) {
-            callback(fullPaths);
-        } else {
-            result.push_back(fullPaths);
-        }
-        num_tree_nodes += 1;
-        num_leafs += 1;
+        reportCycle(fullPaths);
+        metrics.treeNodes += 1;
+        metrics.leafs += 1;
         return;
     }
 
+    blocked[current] += 1;
+
     // first recursion: follow suggested paths
     {
-        auto currentGraph = Graph(g);
-        for (auto u : currentGraph.neighborRange(current)) {
-            if (u != nextNode)
-                currentGraph.removeNode(u);
-        }
+        blockNeighbors(g, current, blocked, nextNode);
         auto newPath(path);
         newPath.push_back(nextNode);
-        allChordlessPathsFollow(currentGraph, nextNode, target, newPath, suggestedPathsReverse);
+        allChordlessPathsFollow(g, nextNode, target, newPath, suggestedPathsReverse, blocked);
+        unblockNeighbors(g, current, blocked, nextNode);
     }
 
     // remaining recursions: follow other paths
     for (auto v : g.neighborRange(current)) {
-        if (v == nextNode)
+        if (isStopped())
+            break;
+        if (v == nextNode || blocked[v] > 0)
             continue;
 
-        auto currentGraph = Graph(g);
+        // create G \ (N(s) \ v) via blocking
+        blockNeighbors(g, current, blocked, v);
 
-        // create G \ (N(s) \ v)
-        for (auto u : currentGraph.neighborRange(current)) {
-            if (u != v)
-                currentGraph.removeNode(u);
-        }
-        currentGraph.removeNode(current);
-
-        auto newSuggestedPathReverse = bfsPaths(currentGraph, v, target, false);
+        auto newSuggestedPathReverse = bfsPaths(g, v, target, blocked, false);
         if (!newSuggestedPathReverse.empty()) {
             // The start node should not be part of the paths to follow
             newSuggestedPathReverse.pop_back();
             auto newPath(path);
             newPath.push_back(v);
-            allChordlessPathsFollow(currentGraph, v, target, newPath, newSuggestedPathReverse);
+            allChordlessPathsFollow(g, v, target, newPath, newSuggestedPathReverse, blocked);
         } else {
-            unsuccessfulBfsCalls += 1;
+            metrics.unsuccessfulBfsCalls += 1;
         }
 
-        // re-add edges
+        // always unblock before next loop
+        unblockNeighbors(g, current, blocked, v);
     }
+
+    blocked[current] -= 1;
 }
 
 } // namespace NetworKit
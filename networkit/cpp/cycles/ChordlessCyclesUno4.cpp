@@ -44,117 +44,104 @@ void ChordlessCyclesUno4::reset() {
     result.clear();
 
     G_copy = Graph(*G);
-    num_tree_nodes = 0;
-    num_leafs = 0;
+    metrics = ChordlessCyclesMetrics();
 }
 
 void ChordlessCyclesUno4::allChordlessPaths(const Graph &g, node current, node target,
-                                            const std::vector<node> &path) {
-    auto suggestedPath = bfsPaths(g, current, target, true);
+                                            const std::vector<node> &path,
+                                            std::vector<count> &blocked) {
+    auto suggestedPath = bfsPaths(g, current, target, blocked, true);
     if (suggestedPath.empty()) {
-        unsuccessfulBfsCalls += 1;
+        metrics.unsuccessfulBfsCalls += 1;
         return;
     } else {
-        // The start node should not be part of the paths to follow
-        std::vector<bool> marks(G->numberOfNodes(), true);
-        allChordlessPathsFollow(g, suggestedPath, 0, marks, 100);
+        marks.push();
+        allChordlessPathsFollow(g, suggestedPath, 0, blocked);
+        marks.pop();
     }
 }
 
 void ChordlessCyclesUno4::allChordlessPathsFollow(const Graph &g, const std::vector<node> &path,
-                                                  uid_t currentPosition, std::vector<bool> &marks,
-                                                  count minLength = 29) {
+                                                  uid_t currentPosition,
+                                                  std::vector<count> &blocked) {
     assert(currentPosition < path.size() - 1);
     auto currentNode = path[currentPosition];
-    assert(g.degree(currentNode) > 0);
+    assert(blocked[currentNode] == 0);
     auto nextNode = path[currentPosition + 1];
     auto targetNode = path[path.size() - 1];
 
-    if (result.size() >= num_max_cyles) {
+    if (isStopped()) {
         return;
     }
-    num_tree_nodes += 1;
+    metrics.treeNodes += 1;
+
+    // everything below works on G \ currentNode
+    blocked[currentNode] += 1;
 
     if (currentPosition >= path.size() - 2) {
-        if (callback) {
-            callback(path);
-        } else {
-            result.push_back(path);
-        }
-        num_tree_nodes += 1;
-        num_leafs += 1;
+        reportCycle(path);
+        metrics.treeNodes += 1;
+        metrics.leafs += 1;
 
         // set marks for use in parent
         // graph search from t but all nodes on path and their neighbors are disallowed
-        auto currentGraph = Graph(g);
-        currentGraph.removeNode(currentNode);
-        auto newMarks = bfsReachableMask(currentGraph, targetNode);
-        for (count i = 0; i < marks.size(); i++) {
-            marks[i] = newMarks[i];
-        }
+        marks.clear();
+        metrics.bfsCalls += 1;
+        metrics.bfsNeighborQueries +=
+            timeBfs([&] { return marks.markReachable(g, targetNode, blocked); });
+
+        blocked[currentNode] -= 1;
         return;
     }
 
     // first recursion: follow suggested paths
     {
-        auto currentGraph = Graph(g);
-        for (auto u : currentGraph.neighborRange(currentNode)) {
-            if (u != nextNode)
-                currentGraph.removeNode(u);
-        }
-        currentGraph.removeNode(currentNode);
-        //if (currentPosition + 1 + cliqueBound(currentGraph) >= minLength)
-        allChordlessPathsFollow(currentGraph, path, currentPosition + 1, marks);
+        blockNeighbors(g, currentNode, blocked, nextNode);
+        allChordlessPathsFollow(g, path, currentPosition + 1, blocked);
+        unblockNeighbors(g, currentNode, blocked, nextNode);
     }
 
     // remaining recursions: follow other paths
     for (auto v : g.neighborRange(currentNode)) {
-        auto neighbors = g.neighborRange(v);
-        if (v == nextNode || !std::any_of(neighbors.begin(), neighbors.end(), [marks](node e) {
-                return marks[e];
-            }))
+        if (isStopped())
+            break;
+        if (v == nextNode || blocked[v] > 0 || !marks.hasMarkedNeighbor(g, v))
             continue;
 
-        auto currentGraph = Graph(g);
-
-        // create G \ (N(s) \ v)
-        for (auto u : currentGraph.neighborRange(currentNode)) {
-            if (u != v)
-                currentGraph.removeNode(u);
-        }
-        currentGraph.removeNode(currentNode);
+        // create G \ (N(s) \ v) via blocking
+        blockNeighbors(g, currentNode, blocked, v);
 
-        auto suggestedSuffix = bfsPaths(currentGraph, v, targetNode, true);
+        auto suggestedSuffix = bfsPaths(g, v, targetNode, blocked, true);
         if (!suggestedSuffix.empty()) {
             // The start node should not be part of the paths to follow
             std::vector<node> newPath = {path.begin(), path.begin() + currentPosition + 1};
             std::move(suggestedSuffix.begin(), suggestedSuffix.end(), std::back_inserter(newPath));
-            std::vector<bool> newMarks(G->numberOfNodes(), true);
-            //if (currentPosition + 1 + cliqueBound(currentGraph) >= minLength)
-            allChordlessPathsFollow(currentGraph, newPath, currentPosition + 1, newMarks);
+            marks.push();
+            allChordlessPathsFollow(g, newPath, currentPosition + 1, blocked);
+            marks.pop();
         } else {
-            unsuccessfulBfsCalls += 1;
-            //assert(false);
+            metrics.unsuccessfulBfsCalls += 1;
         }
-    }
 
-    auto currentGraph = Graph(g);
-    currentGraph.removeNode(currentNode);
-    auto pseudoNode = currentGraph.addNode();
-    // go up, update marks
-    for (auto v : g.neighborRange(currentNode)) {
-        auto neighbors = g.neighborRange(v);
-        if (std::any_of(neighbors.begin(), neighbors.end(), [marks](node e) { return marks[e]; }))
-            currentGraph.addEdge(v, pseudoNode);
+        unblockNeighbors(g, currentNode, blocked, v);
     }
-    for (auto v : g.nodeRange()) {
-        if (marks[v] & currentGraph.hasNode(v))
-            currentGraph.removeNode(v);
+
+    if (isStopped()) {
+        blocked[currentNode] -= 1;
+        return;
     }
-    auto newMarks = bfsReachableMask(currentGraph, pseudoNode);
-    for (count i = 0; i < marks.size(); i++) {
-        marks[i] = marks[i] | newMarks[i];
+
+    // go up, update marks: only the neighbors of currentNode become available again, so
+    // everything newly reachable is found by searching from those next to a marked node
+    for (auto v : g.neighborRange(currentNode)) {
+        if (blocked[v] == 0 && !marks.isMarked(v) && marks.hasMarkedNeighbor(g, v)) {
+            metrics.bfsCalls += 1;
+            metrics.bfsNeighborQueries +=
+                timeBfs([&] { return marks.markReachable(g, v, blocked); });
+        }
     }
+
+    blocked[currentNode] -= 1;
 }
 
 } // namespace NetworKit
@@ -1,129 +1,652 @@
 // no-networkit-format
 
-#include "networkit/cycles/ChordlessCyclesUno41.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <deque>
 #include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <omp.h>
+
+#include "networkit/cycles/ChordlessCyclesUno41.hpp"
+#include "networkit/auxiliary/Random.hpp"
+#include "networkit/auxiliary/Timer.hpp"
 #include "networkit/clique/MaximalCliques.hpp"
+#include "networkit/components/BiconnectedComponents.hpp"
 
 namespace NetworKit {
 
 using paths = std::vector<node>;
 
+// An unexplored subtree of allChordlessPathsFollow: the cycles that continue the path
+// prefix with next and end in target, within the task of node_order[position].
+struct ChordlessCyclesUno41::Branch {
+    index position;
+    std::vector<node> finishedNeighbors;
+    std::vector<node> prefix;
+    node next;
+    node target;
+};
+
+struct ChordlessCyclesUno41::BranchScheduler {
+    std::mutex mutex;
+    std::deque<Branch> branches;
+    std::atomic<count> numPending{0};
+    std::atomic<count> numIdle{0};
+    count numThreads = 0;
+
+    bool wantsWork() const {
+        return numPending.load(std::memory_order_relaxed)
+               < numIdle.load(std::memory_order_relaxed);
+    }
+};
+
 void ChordlessCyclesUno41::reset() {
+    if ((!checkpointFile.empty() || !resumeFile.empty()) && (parallel || blockDecomposition))
+        throw std::runtime_error("Error: checkpoints are only supported by the sequential "
+                                 "enumeration without block decomposition");
     hasRun = false;
     result.clear();
 
     G_copy = Graph(*G);
-    num_tree_nodes = 0;
-    num_leafs = 0;
+    metrics = ChordlessCyclesMetrics();
 }
 
 void ChordlessCyclesUno41::allChordlessPaths(const Graph &g, node current, node target,
                                              const std::vector<node> &path,
-                                             std::vector<count> blocked) {
-    auto suggestedPath = bfsPaths(g, current, target, blocked, true);
+                                             std::vector<count> &blocked) {
+    computeDistances(g, target, blocked);
+    auto suggestedPath = suggestPath(g, 0, current, target, blocked);
     if (suggestedPath.empty()) {
-        unsuccessfulBfsCalls += 1;
+        metrics.unsuccessfulBfsCalls += 1;
         return;
     } else {
-        std::vector<bool> marks(G->upperNodeIdBound(), true);
-        allChordlessPathsFollow(g, suggestedPath, 0, marks, blocked, 100);
+        marks.push();
+        allChordlessPathsFollow(g, suggestedPath, 0, blocked);
+        marks.pop();
     }
 }
 
+void ChordlessCyclesUno41::runForNewEdge(node u, node v) {
+    if (u == v || G->hasEdge(u, v))
+        throw std::runtime_error("Error: the edge must be new and no self-loop");
+    hasRun = false;
+    result.clear();
+    resumed = Checkpoint();
+    openOutput();
+
+    // Reused across calls, such that an update of a large graph stays local
+    if (edgeBlocked.size() < G->upperNodeIdBound())
+        edgeBlocked.resize(G->upperNodeIdBound(), 0);
+    allChordlessPaths(*G, u, v, {u}, edgeBlocked);
+
+    closeOutput();
+    hasRun = true;
+}
+
+void ChordlessCyclesUno41::setLengthBounds(count minLength, count maxLength) {
+    if (minLength < 3 || minLength > maxLength)
+        throw std::runtime_error("Error: the length bounds must satisfy 3 <= min <= max");
+    this->minLength = minLength;
+    this->maxLength = maxLength;
+}
+
+void ChordlessCyclesUno41::computeDistances(const Graph &g, node target,
+                                            const std::vector<count> &blocked) {
+    if (maxLength == none)
+        return;
+    // Nodes farther away cannot be on a short enough cycle anyway
+    metrics.bfsCalls += 1;
+    timeBfs([&] { return distanceBFS.run(g, target, &blocked, none, maxLength - 1); });
+    metrics.bfsNeighborQueries += distanceBFS.getNeighborQueries();
+}
+
+bool ChordlessCyclesUno41::exceedsMaxLength(count prefixLength, node next) const {
+    // Blocking more nodes never shortens the distances computed for the inner loop
+    return maxLength != none
+           && (!distanceBFS.isReached(next)
+               || prefixLength + distanceBFS.getDistance(next) + 1 > maxLength);
+}
+
+std::vector<node> ChordlessCyclesUno41::suggestPath(const Graph &g, count prefixLength,
+                                                    node next, node target,
+                                                    const std::vector<count> &blocked) {
+    if (exceedsMaxLength(prefixLength, next))
+        return {};
+
+    std::vector<node> suggestedPath;
+    if (minLength <= 3) {
+        suggestedPath = bfsPaths(g, next, target, blocked);
+    } else if (blocked[target] == 0) {
+        // A full search also bounds the number of nodes of any path from next
+        metrics.bfsCalls += 1;
+        timeBfs([&] { return blockedBFS.run(g, next, &blocked); });
+        metrics.bfsNeighborQueries += blockedBFS.getNeighborQueries();
+        if (prefixLength + blockedBFS.numberOfReachedNodes() >= minLength)
+            suggestedPath = blockedBFS.getPath(target);
+    }
+
+    // The suggested path is a shortest one, so all cycles of the branch are at least as long
+    if (maxLength != none && prefixLength + suggestedPath.size() > maxLength)
+        suggestedPath.clear();
+    return suggestedPath;
+}
+
 void ChordlessCyclesUno41::destructiveEnumeration() {
-    std::vector<uint64_t> blocked(G->upperNodeIdBound(), 0);
+    if (blockDecomposition)
+        blockEnumeration();
+    else if (parallel)
+        parallelEnumeration();
+    else
+        ChordlessCycles::destructiveEnumeration();
+}
 
-    for (auto u : node_order) {
-        num_outer_loops += 1;
+void ChordlessCyclesUno41::constructiveEnumeration() {
+    if (blockDecomposition)
+        blockEnumeration();
+    else if (parallel)
+        parallelEnumeration();
+    else
+        ChordlessCycles::constructiveEnumeration();
+}
 
-        if (result.size() >= num_max_cyles) {
-            break;
+void ChordlessCyclesUno41::moveToPosition(index position, std::vector<count> &blocked) {
+    // constructive: the nodes up to taskPosition are added,
+    // destructive: the nodes before taskPosition are removed
+    if (constructive) {
+        for (; taskPosition > position; --taskPosition)
+            blocked[node_order[taskPosition]] += 1;
+        for (; taskPosition < position; ++taskPosition)
+            blocked[node_order[taskPosition + 1]] -= 1;
+    } else {
+        for (; taskPosition < position; ++taskPosition)
+            blocked[node_order[taskPosition]] += 1;
+        for (; taskPosition > position; --taskPosition)
+            blocked[node_order[taskPosition - 1]] -= 1;
+    }
+}
+
+bool ChordlessCyclesUno41::writeCycle(const std::vector<node> &cycle) {
+    bool goOn;
+#pragma omp critical(ChordlessCyclesUno41Output)
+    {
+        reportCycle(cycle);
+        goOn = !stopped;
+    }
+    return goOn;
+}
+
+void ChordlessCyclesUno41::parallelEnumeration() {
+    const count n = node_order.size();
+    if (n == 0)
+        return;
+
+    // Cycles found per position of the node order, concatenated in order afterwards, unless
+    // they are written to the output file right away. Within a block enumeration, the stop
+    // flag and count of the whole run are shared.
+    std::vector<std::pair<index, CycleStore>> found;
+    std::atomic<count> localNumFound{0};
+    std::atomic<bool> localStop{stopped};
+    std::atomic<count> &numFound = sharedNumFound ? *sharedNumFound : localNumFound;
+    std::atomic<bool> &stopAll = sharedStop ? *sharedStop : localStop;
+    count numCallbacks = 0;
+    BranchScheduler branchScheduler;
+
+#pragma omp parallel
+    {
+#pragma omp single
+        branchScheduler.numThreads = omp_get_num_threads();
+
+        ChordlessCyclesUno41 worker(*G, node_order, num_max_cyles, constructive);
+        if (forwardsOutput) {
+            worker.callback = callback;
+        } else if (callback) {
+            // Never more than num_max_cyles calls and none after the callback returned false
+            worker.callback = [&](const std::vector<node> &path) {
+                bool goOn = false;
+#pragma omp critical(ChordlessCyclesUno41Callback)
+                if (!stopAll.load(std::memory_order_relaxed) && numCallbacks < num_max_cyles) {
+                    numCallbacks += 1;
+                    goOn = callback(path);
+                }
+                return goOn;
+            };
+        } else if (outputStream) {
+            worker.callback = [&](const std::vector<node> &path) { return writeCycle(path); };
+        }
+        worker.sharedStop = &stopAll;
+        worker.sharedNumFound = &numFound;
+        worker.signalHandler = signalHandler;
+        worker.countOnly = countOnly;
+        worker.compactStorage = !countOnly;
+        worker.bidirectional = bidirectional;
+        worker.minLength = minLength;
+        worker.maxLength = maxLength;
+        if (splitBranches)
+            worker.scheduler = &branchScheduler;
+        worker.reset();
+
+        std::vector<std::pair<index, CycleStore>> localFound;
+        auto collect = [&](index position) {
+            if (worker.cycleStore.size() == 0)
+                return;
+            localFound.emplace_back(position, std::move(worker.cycleStore));
+            worker.cycleStore.clear();
+        };
+
+        // The blocked counters of a task only depend on its position in the node order.
+        // The monotonic schedule hands each thread increasing loop indices, so the counters
+        // are shifted incrementally in O(n) per thread. OpenMP 5 defaults to nonmonotonic
+        // dynamic schedules, under which the shifts stay correct but may cost O(n) per task.
+        std::vector<count> blocked(G->upperNodeIdBound(), constructive ? 1 : 0);
+        if (constructive) {
+            for (auto u : node_order)
+                blocked[u] -= 1;
+            worker.taskPosition = n - 1;
         }
 
-        std::vector<node> neighbors;
-        for (auto v : G_copy.neighborRange(u)) {
-            if (blocked[v] == 0)
-                neighbors.push_back(v);
+        // Constructive tasks grow with their position, so start with the last one
+#ifndef NETWORKIT_OMP2
+#pragma omp for schedule(monotonic : dynamic, 1) nowait
+#else
+#pragma omp for schedule(dynamic, 1) nowait
+#endif
+        for (omp_index k = 0; k < static_cast<omp_index>(n); ++k) {
+            const index i = constructive ? n - 1 - k : k;
+            if (worker.isStopped())
+                continue;
+
+            worker.moveToPosition(i, blocked);
+            worker.metrics.outerLoops += 1;
+            worker.enumerateCyclesThrough(node_order[i], blocked);
+            collect(i);
         }
 
-        for (auto v : neighbors) {
-            num_inner_loops += 1;
-            G_copy.removeEdge(u, v);
-            std::vector<node> path;
-            path.push_back(u);
-            // biConReport(G_copy);
-            allChordlessPaths(G_copy, u, v, path, blocked);
-            blocked[v] += 1;
+        // Out of tasks: follow branches donated by the other threads until all are idle
+        if (splitBranches) {
+            branchScheduler.numIdle += 1;
+            while (true) {
+                Branch branch;
+                {
+                    std::lock_guard<std::mutex> guard(branchScheduler.mutex);
+                    if (branchScheduler.branches.empty()) {
+                        if (branchScheduler.numIdle == branchScheduler.numThreads)
+                            break;
+                        branch.position = none;
+                    } else {
+                        branch = std::move(branchScheduler.branches.front());
+                        branchScheduler.branches.pop_front();
+                        branchScheduler.numPending -= 1;
+                        branchScheduler.numIdle -= 1;
+                    }
+                }
+
+                if (branch.position == none) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                if (!worker.isStopped()) {
+                    worker.followBranch(branch, blocked);
+                    collect(branch.position);
+                }
+                branchScheduler.numIdle += 1;
+            }
         }
 
-        blocked[u] += 1;
-        for (auto v : neighbors) {
-            G_copy.addEdge(u, v);
-            blocked[v] -= 1;
+#pragma omp critical(ChordlessCyclesUno41Metrics)
+        {
+            metrics.add(worker.metrics);
+            if (countOnly)
+                addCounts(worker);
+            std::move(localFound.begin(), localFound.end(), std::back_inserter(found));
         }
     }
+
+    stopped = stopAll.load() || isStopped();
+    if (callback && !forwardsOutput)
+        numFoundCycles = numCallbacks;
+
+    metrics.threads = branchScheduler.numThreads;
+
+    // The workers counted the cycles against a shared limit already
+    auto *const numFoundOfRun = sharedNumFound;
+    sharedNumFound = nullptr;
+    std::stable_sort(found.begin(), found.end(),
+                     [](const auto &x, const auto &y) { return x.first < y.first; });
+    for (const auto &cycles : found)
+        cycles.second.forCycles([&](const std::vector<node> &cycle) { reportCycle(cycle); });
+    sharedNumFound = numFoundOfRun;
 }
 
-void ChordlessCyclesUno41::constructiveEnumeration() {
-    // no node added in the beginning
-    std::vector<uint64_t> blocked(G->upperNodeIdBound(), 1);
+void ChordlessCyclesUno41::blockEnumeration() {
+    Aux::StartedTimer timer;
+    BiconnectedComponents bcc(*G);
+    bcc.run();
+    auto blocks = bcc.getComponents();
+
+    // Bridges and isolated nodes lie on no cycle; search the largest blocks first
+    blocks.erase(std::remove_if(blocks.begin(), blocks.end(),
+                                [](const std::vector<node> &block) { return block.size() < 3; }),
+                 blocks.end());
+    std::stable_sort(blocks.begin(), blocks.end(),
+                     [](const std::vector<node> &x, const std::vector<node> &y) {
+                         return x.size() > y.size();
+                     });
+    metrics.preprocessingSeconds += timer.elapsedNanoseconds() * 1e-9;
+    if (blocks.empty())
+        return;
 
-    for (auto u : node_order) {
-        num_outer_loops += 1;
-        count numBefore = result.size();
+    timer.start();
+    std::vector<index> positionInOrder(G->upperNodeIdBound(), none);
+    for (index i = 0; i < node_order.size(); ++i)
+        positionInOrder[node_order[i]] = i;
+    metrics.orderingSeconds += timer.elapsedNanoseconds() * 1e-9;
+
+    // Blocks with more than their share of nodes per thread are searched by all threads
+    const count numThreads = parallel ? omp_get_max_threads() : 1;
+    metrics.threads = numThreads;
+    count totalSize = 0;
+    for (const auto &block : blocks)
+        totalSize += block.size();
+    index numLarge = 0;
+    if (numThreads > 1)
+        while (numLarge < blocks.size() && blocks[numLarge].size() * numThreads > totalSize)
+            ++numLarge;
+
+    // Cycles found per block, with the node ids of G, if not written to the output file
+    std::vector<CycleStore> found(blocks.size());
+    std::atomic<count> numFound{0};
+    std::atomic<bool> stopAll{stopped};
+    count numCallbacks = 0;
+
+    // Relabel the block to 0..k-1 with its nodes of the node order first, in order
+    auto enumerateBlock = [&](index b, bool parallelBlock, std::vector<node> &localId) {
+        auto &nodes = blocks[b];
+        std::stable_sort(nodes.begin(), nodes.end(), [&](node u, node v) {
+            return positionInOrder[u] < positionInOrder[v];
+        });
+        std::vector<node> localOrder;
+        for (index i = 0; i < nodes.size(); ++i) {
+            localId[nodes[i]] = i;
+            if (positionInOrder[nodes[i]] != none)
+                localOrder.push_back(i);
+        }
 
-        if (result.size() >= num_max_cyles) {
-            break;
+        // Two blocks share at most one node, so any edge within the block belongs to it
+        Graph subgraph(nodes.size());
+        for (index i = 0; i < nodes.size(); ++i) {
+            G->forNeighborsOf(nodes[i], [&](node v) {
+                if (localId[v] != none && localId[v] > i)
+                    subgraph.addEdge(i, localId[v]);
+            });
         }
+        for (auto u : nodes)
+            localId[u] = none;
 
-        // add node u and available edges
-        blocked[u] -= 1;
+        ChordlessCyclesUno41 worker(subgraph, localOrder, num_max_cyles, constructive);
+        if (callback) {
+            worker.callback = [&](const std::vector<node> &path) {
+                std::vector<node> cycle(path.size());
+                for (index i = 0; i < path.size(); ++i)
+                    cycle[i] = nodes[path[i]];
+                bool goOn = false;
+#pragma omp critical(ChordlessCyclesUno41BlockCallback)
+                if (!stopAll.load(std::memory_order_relaxed) && numCallbacks < num_max_cyles) {
+                    numCallbacks += 1;
+                    goOn = callback(cycle);
+                }
+                return goOn;
+            };
+        } else if (outputStream) {
+            worker.callback = [&](const std::vector<node> &path) {
+                std::vector<node> cycle(path.size());
+                for (index i = 0; i < path.size(); ++i)
+                    cycle[i] = nodes[path[i]];
+                return writeCycle(cycle);
+            };
+            worker.forwardsOutput = true;
+        }
+        worker.sharedStop = &stopAll;
+        worker.sharedNumFound = &numFound;
+        worker.signalHandler = signalHandler;
+        worker.countOnly = countOnly;
+        worker.compactStorage = !countOnly;
+        worker.bidirectional = bidirectional;
+        worker.minLength = minLength;
+        worker.maxLength = maxLength;
+        worker.parallel = parallelBlock;
+        worker.splitBranches = splitBranches;
+
+        worker.reset();
+        worker.openOutput();
+        if (constructive)
+            worker.constructiveEnumeration();
+        else
+            worker.destructiveEnumeration();
+        if (worker.stopped)
+            stopAll = true;
+
+        std::vector<node> cycle;
+        worker.cycleStore.forCycles([&](const std::vector<node> &path) {
+            cycle.resize(path.size());
+            for (index i = 0; i < path.size(); ++i)
+                cycle[i] = nodes[path[i]];
+            found[b].add(cycle);
+        });
+
+#pragma omp critical(ChordlessCyclesUno41Metrics)
+        {
+            metrics.add(worker.metrics);
+            if (countOnly)
+                addCounts(worker);
+        }
+    };
+
+    std::vector<node> localId(G->upperNodeIdBound(), none);
+    for (index b = 0; b < numLarge && !stopAll && !isStopped(); ++b)
+        enumerateBlock(b, true, localId);
 
-        // enum all chordless paths through u
-        std::vector<node> neighbors;
-        for (auto v : G_copy.neighborRange(u)) {
-            if (blocked[v] == 0)
-                neighbors.push_back(v);
+#pragma omp parallel if (numThreads > 1)
+    {
+        std::vector<node> threadLocalId(G->upperNodeIdBound(), none);
+
+#pragma omp for schedule(dynamic, 1)
+        for (omp_index b = numLarge; b < static_cast<omp_index>(blocks.size()); ++b) {
+            if (stopAll.load(std::memory_order_relaxed)
+                || (signalHandler && !signalHandler->isRunning()))
+                continue;
+            enumerateBlock(b, false, threadLocalId);
         }
+    }
+
+    stopped = stopAll.load() || isStopped();
+    if (callback)
+        numFoundCycles = numCallbacks;
 
-        for (auto v : neighbors) {
-            num_inner_loops += 1;
-            G_copy.removeEdge(u, v);
-            std::vector<node> path;
-            path.push_back(u);
-            // biConReport(G_copy);
-            allChordlessPaths(G_copy, u, v, path, blocked);
-            blocked[v] += 1;
+    for (const auto &cycles : found)
+        cycles.forCycles([&](const std::vector<node> &cycle) { reportCycle(cycle); });
+}
+
+ChordlessCyclesUno41::SearchTreeEstimate
+ChordlessCyclesUno41::estimateSearchTree(double seconds, count maxProbes) const {
+    SearchTreeEstimate estimate;
+    const count n = node_order.size();
+    if (n == 0)
+        return estimate;
+
+    const auto deadline = std::chrono::steady_clock::now()
+                          + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<double>(seconds));
+    std::atomic<count> numProbes{0};
+    double sumOfSquares = 0;
+
+#pragma omp parallel if (parallel)
+    {
+        ChordlessCyclesUno41 prober(*G, node_order, num_max_cyles, constructive);
+        prober.bidirectional = bidirectional;
+        prober.minLength = minLength;
+        prober.maxLength = maxLength;
+        prober.reset();
+
+        std::vector<count> blocked(G->upperNodeIdBound(), constructive ? 1 : 0);
+        if (constructive) {
+            for (auto u : node_order)
+                blocked[u] -= 1;
+            prober.taskPosition = n - 1;
+        }
+
+        SearchTreeEstimate local;
+        double localSumOfSquares = 0;
+        while (std::chrono::steady_clock::now() < deadline && numProbes++ < maxProbes) {
+            const auto sample = prober.probeSearchTree(blocked);
+            local.treeNodes += sample.treeNodes;
+            local.cycles += sample.cycles;
+            local.bfsNeighborQueries += sample.bfsNeighborQueries;
+            local.probes += 1;
+            localSumOfSquares += sample.cycles * sample.cycles;
         }
 
-        for (auto v : neighbors) {
-            G_copy.addEdge(u, v);
-            blocked[v] -= 1;
+#pragma omp critical(ChordlessCyclesUno41Estimate)
+        {
+            estimate.treeNodes += local.treeNodes;
+            estimate.cycles += local.cycles;
+            estimate.bfsNeighborQueries += local.bfsNeighborQueries;
+            estimate.probes += local.probes;
+            sumOfSquares += localSumOfSquares;
         }
-        count numAfter = result.size();
-        //std::cout << numAfter - numBefore << ", ";
     }
-    //std::cout << std::endl;
-}
 
-void inline blockNeighbors(const Graph &g, node u, std::vector<count> &blocked, node exception) {
-    for (auto v : g.neighborRange(u)) {
-        if (v != exception)
-            blocked[v] += 1;
+    if (estimate.probes == 0)
+        return estimate;
+    const double k = static_cast<double>(estimate.probes);
+    estimate.treeNodes /= k;
+    estimate.cycles /= k;
+    estimate.bfsNeighborQueries /= k;
+    if (estimate.probes > 1) {
+        const double variance = (sumOfSquares - k * estimate.cycles * estimate.cycles) / (k - 1);
+        estimate.cyclesStandardError = std::sqrt(std::max(variance, 0.0) / k);
     }
+    return estimate;
 }
 
-void inline unblockNeighbors(const Graph &g, node u, std::vector<count> &blocked, node exception) {
-    for (auto v : g.neighborRange(u)) {
-        if (v != exception)
-            blocked[v] -= 1;
+ChordlessCyclesUno41::SearchTreeEstimate
+ChordlessCyclesUno41::probeSearchTree(std::vector<count> &blocked) {
+    SearchTreeEstimate sample;
+    sample.probes = 1;
+
+    const count n = node_order.size();
+    const index i = Aux::Random::integer(n - 1);
+    moveToPosition(i, blocked);
+    const node u = node_order[i];
+
+    std::vector<node> neighbors;
+    for (auto v : G_copy.neighborRange(u)) {
+        if (blocked[v] == 0)
+            neighbors.push_back(v);
+    }
+    if (neighbors.empty())
+        return sample;
+
+    // The inner loop of the j-th neighbor runs without the edges to the earlier ones
+    const index j = Aux::Random::integer(neighbors.size() - 1);
+    const node target = neighbors[j];
+    double weight = static_cast<double>(n) * neighbors.size();
+    for (index k = 0; k <= j; ++k)
+        G_copy.removeEdge(u, neighbors[k]);
+    for (index k = 0; k < j; ++k)
+        blocked[neighbors[k]] += 1;
+
+    const count queriesBefore = metrics.bfsNeighborQueries;
+    computeDistances(G_copy, target, blocked);
+    auto path = suggestPath(G_copy, 0, u, target, blocked);
+    sample.bfsNeighborQueries += weight * (metrics.bfsNeighborQueries - queriesBefore);
+
+    // A child of a tree node follows the suggested path or a detour through another
+    // neighbor that leads to the target; the nodes are blocked as on the way down
+    struct Detour {
+        node next;
+        std::vector<node> suffix;
+    };
+    std::vector<std::pair<node, node>> followed;
+    for (index position = 0; !path.empty(); ++position) {
+        sample.treeNodes += weight;
+        const node current = path[position];
+        if (position >= path.size() - 2) {
+            if (path.size() >= minLength)
+                sample.cycles += weight;
+            // The leaf marks the nodes reachable from the target for its ancestors
+            blocked[current] += 1;
+            marks.push();
+            sample.bfsNeighborQueries += weight * marks.markReachable(G_copy, target, blocked);
+            marks.pop();
+            blocked[current] -= 1;
+            break;
+        }
+
+        blocked[current] += 1;
+        const node next = path[position + 1];
+        std::vector<Detour> detours;
+        count detourQueries = 0;
+        for (auto v : G_copy.neighborRange(current)) {
+            if (v == next || blocked[v] > 0 || exceedsMaxLength(position + 1, v))
+                continue;
+            blockNeighbors(G_copy, current, blocked, v);
+            const count before = metrics.bfsNeighborQueries;
+            auto suffix = suggestPath(G_copy, position + 1, v, target, blocked);
+            if (!suffix.empty()) {
+                detours.push_back({v, std::move(suffix)});
+                detourQueries += metrics.bfsNeighborQueries - before;
+            }
+            unblockNeighbors(G_copy, current, blocked, v);
+        }
+        // run() searches the path of every detour at this tree node, the marks leave out
+        // the neighbors without one
+        sample.bfsNeighborQueries += weight * detourQueries;
+
+        const index child = Aux::Random::integer(detours.size());
+        weight *= detours.size() + 1;
+        if (child == 0) {
+            followed.emplace_back(current, next);
+        } else {
+            const auto &detour = detours[child - 1];
+            followed.emplace_back(current, detour.next);
+            path.resize(position + 1);
+            path.insert(path.end(), detour.suffix.begin(), detour.suffix.end());
+        }
+        blockNeighbors(G_copy, current, blocked, followed.back().second);
+    }
+
+    for (auto it = followed.rbegin(); it != followed.rend(); ++it) {
+        unblockNeighbors(G_copy, it->first, blocked, it->second);
+        blocked[it->first] -= 1;
     }
+    for (index k = 0; k <= j; ++k)
+        G_copy.addEdge(u, neighbors[k]);
+    for (index k = 0; k < j; ++k)
+        blocked[neighbors[k]] -= 1;
+    return sample;
+}
+
+void ChordlessCyclesUno41::donateBranch(const std::vector<node> &path, uid_t currentPosition,
+                                        node next) {
+    Branch branch{taskPosition,
+                  finishedNeighbors,
+                  {path.begin(), path.begin() + currentPosition + 1},
+                  next,
+                  path.back()};
+
+    std::lock_guard<std::mutex> guard(scheduler->mutex);
+    scheduler->branches.push_back(std::move(branch));
+    scheduler->numPending += 1;
 }
 
 void ChordlessCyclesUno41::allChordlessPathsFollow(const Graph &g, const std::vector<node> &path,
-                                                   uid_t currentPosition, std::vector<bool> &marks,
-                                                   std::vector<count> &blocked,
-                                                   count minLength = 29) {
+                                                   uid_t currentPosition,
+                                                   std::vector<count> &blocked) {
     assert(currentPosition < path.size() - 1);
     auto currentNode = path[currentPosition];
     assert(g.degree(currentNode) > 0);
@@ -131,27 +654,24 @@ void ChordlessCyclesUno41::allChordlessPathsFollow(const Graph &g, const std::ve
     auto nextNode = path[currentPosition + 1];
     auto targetNode = path[path.size() - 1];
 
-    if (result.size() >= num_max_cyles) {
+    if (isStopped()) {
         return;
     }
-    num_tree_nodes += 1;
+    metrics.treeNodes += 1;
     blocked[currentNode] += 1;
 
     if (currentPosition >= path.size() - 2) {
-        if (callback) {
-            bool goOn = callback(path);
-        } else {
-            result.push_back(path);
-        }
-        num_tree_nodes += 1;
-        num_leafs += 1;
+        if (path.size() >= minLength)
+            reportCycle(path);
+        metrics.treeNodes += 1;
+        metrics.leafs += 1;
 
         // set marks for use in parent
         // graph search from t but all nodes on path and their neighbors are disallowed
-        auto newMarks = bfsReachableMask(g, targetNode, blocked);
-        for (count i = 0; i < marks.size(); i++) {
-            marks[i] = newMarks[i];
-        }
+        marks.clear();
+        metrics.bfsCalls += 1;
+        metrics.bfsNeighborQueries +=
+            timeBfs([&] { return marks.markReachable(g, targetNode, blocked); });
 
         // unblock current before going up
         blocked[currentNode] -= 1;
@@ -161,55 +681,46 @@ void ChordlessCyclesUno41::allChordlessPathsFollow(const Graph &g, const std::ve
     // first recursion: follow suggested paths
     {
         blockNeighbors(g, currentNode, blocked, nextNode);
-        allChordlessPathsFollow(g, path, currentPosition + 1, marks, blocked);
+        allChordlessPathsFollow(g, path, currentPosition + 1, blocked);
         unblockNeighbors(g, currentNode, blocked, nextNode);
     }
 
     // remaining recursions: follow other paths
     for (auto v : g.neighborRange(currentNode)) {
-        auto neighbors = g.neighborRange(v);
-        if ((v == nextNode) || (blocked[v] > 0)
-            || !std::any_of(neighbors.begin(), neighbors.end(),
-                            [marks](node e) { return marks[e]; }))
+        if (isStopped())
+            break;
+        if ((v == nextNode) || (blocked[v] > 0) || exceedsMaxLength(currentPosition + 1, v)
+            || !marks.hasMarkedNeighbor(g, v))
+            continue;
+
+        if (scheduler && scheduler->wantsWork()) {
+            donateBranch(path, currentPosition, v);
             continue;
+        }
 
         // create G \ (N(s) \ v) via blocking
         blockNeighbors(g, currentNode, blocked, v);
 
-        auto suggestedSuffix = bfsPaths(g, v, targetNode, blocked);
-        if (!suggestedSuffix.empty()) {
-            // The start node should not be part of the paths to follow
-            std::vector<node> newPath = {path.begin(), path.begin() + currentPosition + 1};
-            std::move(suggestedSuffix.begin(), suggestedSuffix.end(), std::back_inserter(newPath));
-            std::vector<bool> newMarks(G->upperNodeIdBound(), true);
-            // if (currentPosition + 1 + cliqueBound(currentGraph) >= minLength)
-            allChordlessPathsFollow(g, newPath, currentPosition + 1, newMarks, blocked);
-        } else {
-            unsuccessfulBfsCalls += 1;
-            // assert(false);
-        }
+        followDetour(g, {path.begin(), path.begin() + currentPosition + 1}, v, targetNode,
+                     blocked);
 
         // always unblock before next loop
         unblockNeighbors(g, currentNode, blocked, v);
     }
 
-    auto fakeBlocked = std::vector<node>(blocked);
-    for (auto u : g.nodeRange()) {
-        if (marks[u]) {
-            fakeBlocked[u] += 1;
-        }
+    if (isStopped()) {
+        blocked[currentNode] -= 1;
+        return;
     }
+
+    // Only the neighbors of current become available again, so marks grows from them
     for (auto v : g.neighborRange(currentNode)) {
-        auto neighbors = g.neighborRange(v);
-        if ((fakeBlocked[v] == 0)
-            & std::any_of(neighbors.begin(), neighbors.end(),
-                          [marks](node e) { return marks[e]; })) {
+        if (blocked[v] == 0 && !marks.isMarked(v) && marks.hasMarkedNeighbor(g, v)) {
             // graph explore from node, but skip all marked or blocked
             // update marks of newly reachable nodes
-            for (auto u : allBfsReachable(g, v, fakeBlocked)) {
-                marks[u] = true;
-                fakeBlocked[u] += 1;
-            }
+            metrics.bfsCalls += 1;
+            metrics.bfsNeighborQueries +=
+                timeBfs([&] { return marks.markReachable(g, v, blocked); });
         }
     }
 
@@ -218,4 +729,57 @@ void ChordlessCyclesUno41::allChordlessPathsFollow(const Graph &g, const std::ve
     return;
 }
 
+void ChordlessCyclesUno41::followBranch(const Branch &branch, std::vector<count> &blocked) {
+    // Restore the state of the donating thread: the task of branch.position with the
+    // edges to the finished neighbors and the target removed, and the prefix blocked
+    // exactly as allChordlessPathsFollow does on its way down.
+    moveToPosition(branch.position, blocked);
+    const auto &prefix = branch.prefix;
+    const node u = prefix.front();
+
+    finishedNeighbors = branch.finishedNeighbors;
+    for (auto v : finishedNeighbors) {
+        G_copy.removeEdge(u, v);
+        blocked[v] += 1;
+    }
+    G_copy.removeEdge(u, branch.target);
+    computeDistances(G_copy, branch.target, blocked);
+
+    for (index j = 0; j < prefix.size(); ++j) {
+        blocked[prefix[j]] += 1;
+        blockNeighbors(G_copy, prefix[j], blocked,
+                       j + 1 < prefix.size() ? prefix[j + 1] : branch.next);
+    }
+
+    followDetour(G_copy, prefix, branch.next, branch.target, blocked);
+
+    for (index j = prefix.size(); j-- > 0;) {
+        unblockNeighbors(G_copy, prefix[j], blocked,
+                         j + 1 < prefix.size() ? prefix[j + 1] : branch.next);
+        blocked[prefix[j]] -= 1;
+    }
+
+    G_copy.addEdge(u, branch.target);
+    for (auto v : finishedNeighbors) {
+        G_copy.addEdge(u, v);
+        blocked[v] -= 1;
+    }
+}
+
+void ChordlessCyclesUno41::followDetour(const Graph &g, std::vector<node> prefix, node next,
+                                        node target, std::vector<count> &blocked) {
+    auto suggestedSuffix = suggestPath(g, prefix.size(), next, target, blocked);
+    if (suggestedSuffix.empty()) {
+        metrics.unsuccessfulBfsCalls += 1;
+        return;
+    }
+
+    // The start node should not be part of the paths to follow
+    const uid_t nextPosition = prefix.size();
+    std::move(suggestedSuffix.begin(), suggestedSuffix.end(), std::back_inserter(prefix));
+    marks.push();
+    allChordlessPathsFollow(g, prefix, nextPosition, blocked);
+    marks.pop();
+}
+
 } // namespace NetworKit
@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <networkit/auxiliary/Log.hpp>
+#include <networkit/cycles/CycleStore.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+const char streamMagic[8] = {'C', 'Y', 'C', 'L', 'E', 'S', '0', '1'};
+
+void truncateFile(const std::string &path, uint64_t size) {
+#ifdef _WIN32
+    int fd = -1;
+    bool truncated = _sopen_s(&fd, path.c_str(), _O_RDWR | _O_BINARY, _SH_DENYNO,
+                              _S_IREAD | _S_IWRITE)
+                     == 0;
+    if (truncated) {
+        truncated = _chsize_s(fd, static_cast<__int64>(size)) == 0;
+        _close(fd);
+    }
+#else
+    const bool truncated = ::truncate(path.c_str(), static_cast<off_t>(size)) == 0;
+#endif
+    if (!truncated)
+        throw std::runtime_error("Error: cycle file " + path + " couldn't be truncated");
+}
+
+void putVarint(uint64_t x, std::vector<uint8_t> &out) {
+    while (x >= 0x80) {
+        out.push_back(static_cast<uint8_t>(x) | 0x80);
+        x >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(x));
+}
+
+uint64_t getVarint(const uint8_t *&in, const uint8_t *end) {
+    uint64_t x = 0;
+    for (unsigned shift = 0; in != end && shift < 64; shift += 7) {
+        const uint8_t byte = *in++;
+        x |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return x;
+    }
+    throw std::runtime_error("Error: truncated cycle data");
+}
+
+// First node, then the zigzag-encoded differences between consecutive nodes
+void encodeCycle(const std::vector<node> &cycle, std::vector<uint8_t> &out) {
+    node previous = 0;
+    for (node u : cycle) {
+        const int64_t delta = static_cast<int64_t>(u - previous);
+        putVarint((static_cast<uint64_t>(delta) << 1) ^ static_cast<uint64_t>(delta >> 63), out);
+        previous = u;
+    }
+}
+
+node decodeNode(const uint8_t *&in, const uint8_t *end, node previous) {
+    const uint64_t zigzag = getVarint(in, end);
+    return previous + static_cast<node>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+}
+
+void decodeCycle(const uint8_t *in, const uint8_t *end, std::vector<node> &cycle) {
+    node previous = 0;
+    while (in != end) {
+        previous = decodeNode(in, end, previous);
+        cycle.push_back(previous);
+    }
+}
+
+} // namespace
+
+CycleStore::CycleStore(bool compressed) : compressed(compressed), offsets(1, 0) {}
+
+void CycleStore::add(const std::vector<node> &cycle) {
+    if (compressed) {
+        encodeCycle(cycle, bytes);
+        offsets.push_back(bytes.size());
+    } else {
+        nodes.insert(nodes.end(), cycle.begin(), cycle.end());
+        offsets.push_back(nodes.size());
+    }
+    totalNodes += cycle.size();
+}
+
+void CycleStore::clear() {
+    offsets.assign(1, 0);
+    nodes.clear();
+    bytes.clear();
+    totalNodes = 0;
+}
+
+std::vector<node> CycleStore::getCycle(index i) const {
+    if (i >= size())
+        throw std::out_of_range("Error: cycle index out of range");
+    std::vector<node> cycle;
+    decode(i, cycle);
+    return cycle;
+}
+
+void CycleStore::decode(index i, std::vector<node> &cycle) const {
+    cycle.clear();
+    if (compressed)
+        decodeCycle(bytes.data() + offsets[i], bytes.data() + offsets[i + 1], cycle);
+    else
+        cycle.assign(nodes.begin() + offsets[i], nodes.begin() + offsets[i + 1]);
+}
+
+CycleStreamWriter::CycleStreamWriter(const std::string &path, count chunkSize)
+    : out(path, std::ios::binary | std::ios::trunc), chunkSize(chunkSize) {
+    if (!out)
+        throw std::runtime_error("Error: cycle file " + path + " couldn't be opened");
+    out.write(streamMagic, sizeof(streamMagic));
+    written = sizeof(streamMagic);
+    buffer.reserve(chunkSize);
+}
+
+CycleStreamWriter::CycleStreamWriter(const std::string &path, count chunkSize,
+                                     uint64_t resumeSize, count numCycles)
+    : chunkSize(chunkSize), numCycles(numCycles), written(resumeSize) {
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        const auto fileSize = in ? static_cast<uint64_t>(in.tellg()) : 0;
+        char magic[sizeof(streamMagic)] = {};
+        in.seekg(0);
+        in.read(magic, sizeof(magic));
+        if (!in || resumeSize < sizeof(streamMagic) || fileSize < resumeSize
+            || !std::equal(streamMagic, streamMagic + sizeof(streamMagic), magic))
+            throw std::runtime_error("Error: " + path + " is no cycle file to resume");
+    }
+    truncateFile(path, resumeSize);
+    out.open(path, std::ios::binary | std::ios::app);
+    if (!out)
+        throw std::runtime_error("Error: cycle file " + path + " couldn't be opened");
+    buffer.reserve(chunkSize);
+}
+
+CycleStreamWriter::~CycleStreamWriter() {
+    // Destructors must not throw; call flush() beforehand to get the error
+    try {
+        flush();
+    } catch (const std::exception &e) {
+        ERROR(e.what());
+    }
+}
+
+void CycleStreamWriter::add(const std::vector<node> &cycle) {
+    putVarint(cycle.size(), buffer);
+    encodeCycle(cycle, buffer);
+    ++numCycles;
+    if (buffer.size() >= chunkSize)
+        flush();
+}
+
+void CycleStreamWriter::flush() {
+    if (buffer.empty())
+        return;
+    out.write(reinterpret_cast<const char *>(buffer.data()),
+              static_cast<std::streamsize>(buffer.size()));
+    out.flush();
+    // The buffered cycles are dropped either way, so the error is reported only once
+    const bool failed = !out;
+    if (!failed)
+        written += buffer.size();
+    buffer.clear();
+    if (failed)
+        throw std::runtime_error("Error: writing the cycle file failed");
+}
+
+CycleStore readCycleStream(const std::string &path, bool compressed) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("Error: cycle file " + path + " couldn't be opened");
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(in)),
+                                   std::istreambuf_iterator<char>());
+    if (data.size() < sizeof(streamMagic)
+        || !std::equal(streamMagic, streamMagic + sizeof(streamMagic), data.begin()))
+        throw std::runtime_error("Error: " + path + " is no cycle file");
+
+    CycleStore store(compressed);
+    std::vector<node> cycle;
+    const uint8_t *it = data.data() + sizeof(streamMagic);
+    const uint8_t *end = data.data() + data.size();
+    while (it != end) {
+        const count length = getVarint(it, end);
+        cycle.clear();
+        for (index i = 0; i < length; ++i)
+            cycle.push_back(decodeNode(it, end, cycle.empty() ? 0 : cycle.back()));
+        store.add(cycle);
+    }
+    return store;
+}
+
+} // namespace NetworKit
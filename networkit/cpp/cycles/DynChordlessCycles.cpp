@@ -0,0 +1,221 @@
+// no-networkit-format
+#include <algorithm>
+#include <stdexcept>
+
+#include "networkit/cycles/DynChordlessCycles.hpp"
+
+namespace NetworKit {
+
+DynChordlessCycles::DynChordlessCycles(const Graph &G) : G(&G) {
+    if (G.isDirected())
+        throw std::runtime_error("Error: chordless cycles of directed graphs are not supported");
+}
+
+void DynChordlessCycles::run() {
+    current.reset(new Graph(*G));
+    if (current->numberOfSelfLoops() > 0)
+        current->removeSelfLoops();
+
+    const count z = current->upperNodeIdBound();
+    cycles.clear();
+    freeIds.clear();
+    cyclesOfNode.assign(z, {});
+    stamp.assign(z, 0);
+    currentStamp = 0;
+
+    std::vector<node> order;
+    current->forNodes([&](node u) { order.push_back(u); });
+    ChordlessCyclesUno41 full(*current, order);
+    full.setParallel(true);
+    full.setBlockDecomposition(true);
+    full.setCompactStorage();
+    full.run();
+    full.getCycleStore().forCycles([&](const std::vector<node> &cycle) { addCycle(cycle); });
+
+    search.reset(new ChordlessCyclesUno41(*current, std::vector<node>()));
+    search->setCompactStorage();
+
+    added.clear();
+    removed.clear();
+    hasRun = true;
+}
+
+void DynChordlessCycles::update(GraphEvent e) {
+    assureFinished();
+    added.clear();
+    removed.clear();
+    apply(e);
+}
+
+void DynChordlessCycles::updateBatch(const std::vector<GraphEvent> &batch) {
+    assureFinished();
+    added.clear();
+    removed.clear();
+    for (const auto &e : batch)
+        apply(e);
+}
+
+void DynChordlessCycles::apply(const GraphEvent &e) {
+    switch (e.type) {
+    case GraphEvent::EDGE_ADDITION:
+        addEdge(e.u, e.v);
+        break;
+    case GraphEvent::EDGE_REMOVAL:
+        removeEdge(e.u, e.v);
+        break;
+    case GraphEvent::NODE_ADDITION:
+        current->addNode();
+        cyclesOfNode.resize(current->upperNodeIdBound());
+        stamp.resize(current->upperNodeIdBound(), 0);
+        break;
+    case GraphEvent::NODE_REMOVAL: {
+        std::vector<node> neighbors;
+        current->forNeighborsOf(e.u, [&](node v) { neighbors.push_back(v); });
+        for (auto v : neighbors)
+            removeEdge(e.u, v);
+        current->removeNode(e.u);
+        break;
+    }
+    case GraphEvent::NODE_RESTORATION:
+        current->restoreNode(e.u);
+        break;
+    default:
+        // Weights do not matter for chordless cycles
+        break;
+    }
+}
+
+void DynChordlessCycles::addEdge(node u, node v) {
+    if (u == v || current->hasEdge(u, v))
+        return;
+
+    // The new edge is a chord of every cycle through both end points
+    for (auto id : cyclesThrough(u, v, false))
+        removeCycle(id);
+
+    std::vector<std::vector<node>> closed;
+    search->runForNewEdge(u, v);
+    search->getCycleStore().forCycles(
+        [&](const std::vector<node> &cycle) { closed.push_back(cycle); });
+
+    current->addEdge(u, v);
+    for (auto &cycle : closed)
+        addCycle(std::move(cycle));
+}
+
+void DynChordlessCycles::removeEdge(node u, node v) {
+    if (u == v || !current->hasEdge(u, v))
+        return;
+
+    // Keep what remains of each cycle through the edge as a path from u to v
+    std::vector<std::vector<node>> paths;
+    for (auto id : cyclesThrough(u, v, true)) {
+        auto path = cycles[id];
+        std::rotate(path.begin(), std::find(path.begin(), path.end(), u), path.end());
+        if (path[1] == v)
+            std::reverse(path.begin() + 1, path.end());
+        removeCycle(id);
+        paths.push_back(std::move(path));
+    }
+
+    current->removeEdge(u, v);
+    addCombinedCycles(paths);
+}
+
+void DynChordlessCycles::addCombinedCycles(const std::vector<std::vector<node>> &paths) {
+    for (index i = 0; i < paths.size(); ++i) {
+        ++currentStamp;
+        for (index k = 1; k + 1 < paths[i].size(); ++k)
+            stamp[paths[i][k]] = currentStamp;
+
+        for (index j = i + 1; j < paths.size(); ++j) {
+            // Both paths are induced, so only their inner nodes may share nodes or edges
+            bool compatible = true;
+            for (index k = 1; compatible && k + 1 < paths[j].size(); ++k) {
+                const node x = paths[j][k];
+                if (stamp[x] == currentStamp)
+                    compatible = false;
+                for (auto y : current->neighborRange(x))
+                    if (stamp[y] == currentStamp)
+                        compatible = false;
+            }
+            if (!compatible)
+                continue;
+
+            std::vector<node> cycle(paths[i]);
+            cycle.insert(cycle.end(), paths[j].rbegin() + 1, paths[j].rend() - 1);
+            addCycle(std::move(cycle));
+        }
+    }
+}
+
+std::vector<index> DynChordlessCycles::cyclesThrough(node u, node v, bool consecutive) const {
+    // Scan the cycles of the end point on fewer cycles
+    if (cyclesOfNode[u].size() > cyclesOfNode[v].size())
+        std::swap(u, v);
+
+    std::vector<index> ids;
+    for (auto id : cyclesOfNode[u]) {
+        const auto &cycle = cycles[id];
+        const auto len = cycle.size();
+        const auto posU = std::find(cycle.begin(), cycle.end(), u) - cycle.begin();
+        const auto posV = std::find(cycle.begin(), cycle.end(), v) - cycle.begin();
+        if (static_cast<count>(posV) == len)
+            continue;
+        const count gap = (posV - posU + len) % len;
+        if (!consecutive || gap == 1 || gap == len - 1)
+            ids.push_back(id);
+    }
+    return ids;
+}
+
+void DynChordlessCycles::addCycle(std::vector<node> cycle) {
+    index id;
+    if (freeIds.empty()) {
+        id = cycles.size();
+        cycles.emplace_back();
+    } else {
+        id = freeIds.back();
+        freeIds.pop_back();
+    }
+
+    for (auto u : cycle)
+        cyclesOfNode[u].insert(id);
+    added.push_back(cycle);
+    cycles[id] = std::move(cycle);
+}
+
+void DynChordlessCycles::removeCycle(index id) {
+    for (auto u : cycles[id])
+        cyclesOfNode[u].erase(id);
+    removed.push_back(std::move(cycles[id]));
+    cycles[id].clear();
+    freeIds.push_back(id);
+}
+
+count DynChordlessCycles::numberOfCycles() const {
+    assureFinished();
+    return cycles.size() - freeIds.size();
+}
+
+std::vector<std::vector<node>> DynChordlessCycles::getChordlessCycles() const {
+    assureFinished();
+    std::vector<std::vector<node>> result;
+    result.reserve(numberOfCycles());
+    for (const auto &cycle : cycles)
+        if (!cycle.empty())
+            result.push_back(cycle);
+    return result;
+}
+
+const std::vector<std::vector<node>> &DynChordlessCycles::getAddedCycles() const {
+    assureFinished();
+    return added;
+}
+
+const std::vector<std::vector<node>> &DynChordlessCycles::getRemovedCycles() const {
+    assureFinished();
+    return removed;
+}
+
+} // namespace NetworKit
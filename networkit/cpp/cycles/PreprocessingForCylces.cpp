@@ -1,12 +1,15 @@
 #include <algorithm>
+#include <chrono>
 #include <climits>
 #include <random>
 
+#include "networkit/centrality/CoreDecomposition.hpp"
 #include "networkit/centrality/EstimateBetweenness.hpp"
 #include "networkit/centrality/PageRank.hpp"
 #include "networkit/components/BiconnectedComponents.hpp"
 #include "networkit/components/ConnectedComponents.hpp"
 #include "networkit/cycles/PreprocessingForCycles.hpp"
+#include "networkit/graph/GraphTools.hpp"
 
 namespace NetworKit {
 
@@ -186,10 +189,20 @@ std::vector<node> largestFirstOrderedNodes(const Graph &g) {
     return nodes;
 }
 
-std::vector<node> randomOrderedNodes(const Graph &g, int seed) {
-    Betweenness b(g);
-    b.run();
+std::vector<node> degeneracyOrderedNodes(const Graph &g) {
+    CoreDecomposition cores(g, false, false, true);
+    cores.run();
+    return cores.getNodeOrder();
+}
+
+std::vector<node> degeneracyOrderedNodes(const Graph &g, const Partition &p) {
+    CoreDecomposition cores(g, false, false, true);
+    cores.restrictToSubsets(p);
+    cores.run();
+    return cores.getNodeOrder();
+}
 
+std::vector<node> randomOrderedNodes(const Graph &g, int seed) {
     std::vector<node> nodes(0);
     for (auto u : g.nodeRange()) {
         nodes.push_back(u);
@@ -246,6 +259,74 @@ std::vector<node> pageRankOrderedNodes(const Graph &g) {
     return nodes;
 }
 
+void NodeOrderChoice::report() const {
+    for (index i = 0; i < candidates.size(); ++i) {
+        const auto &candidate = candidates[i];
+        std::cout << (i == chosen ? "* " : "  ") << candidate.name
+                  << ": est. tree nodes " << candidate.estimate.treeNodes
+                  << ", est. cycles " << candidate.estimate.cycles << " (+- "
+                  << candidate.estimate.cyclesStandardError << ")"
+                  << ", est. bfs neighbor queries " << candidate.estimate.bfsNeighborQueries
+                  << ", probes " << candidate.estimate.probes << ", order "
+                  << candidate.orderSeconds << " s, estimate " << candidate.estimateSeconds
+                  << " s" << std::endl;
+    }
+    std::cout << "Chosen order: " << (chosen == none ? "none" : candidates[chosen].name)
+              << ", selection took " << seconds << " s" << std::endl;
+}
+
+NodeOrderChoice selectNodeOrder(const Graph &g, bool constructive, double secondsPerOrder,
+                                bool parallel) {
+    using clock = std::chrono::steady_clock;
+    auto secondsSince = [](clock::time_point begin) {
+        return std::chrono::duration<double>(clock::now() - begin).count();
+    };
+    const auto begin = clock::now();
+
+    // Degree and centrality orders are worth trying both ways
+    struct OrderHeuristic {
+        std::string name;
+        bool alsoReversed;
+        std::function<std::vector<node>()> compute;
+    };
+    const std::vector<OrderHeuristic> heuristics = {
+        {"degeneracy", true, [&] { return degeneracyOrderedNodes(g); }},
+        {"page_rank", true, [&] { return pageRankOrderedNodes(g); }},
+        {"betweenness_estimated", false, [&] { return betweennessEstimatedOrderedNodes(g, 64); }},
+        {"random", false, [&] { return randomOrderedNodes(g, 0); }}};
+
+    NodeOrderChoice choice;
+    auto evaluate = [&](const std::string &name, std::vector<node> order, double orderSeconds) {
+        NodeOrderChoice::Candidate candidate;
+        candidate.name = name;
+        candidate.orderSeconds = orderSeconds;
+
+        const auto estimateBegin = clock::now();
+        ChordlessCyclesUno41 algo(g, order, std::numeric_limits<int>::max(), constructive);
+        algo.setParallel(parallel);
+        candidate.estimate = algo.estimateSearchTree(secondsPerOrder);
+        candidate.estimateSeconds = secondsSince(estimateBegin);
+
+        choice.candidates.push_back(candidate);
+        if (choice.chosen == none || candidate.cost() < choice.candidates[choice.chosen].cost()) {
+            choice.chosen = choice.candidates.size() - 1;
+            choice.order = std::move(order);
+        }
+    };
+
+    for (const auto &heuristic : heuristics) {
+        const auto orderBegin = clock::now();
+        auto nodes = heuristic.compute();
+        const double orderSeconds = secondsSince(orderBegin);
+        if (heuristic.alsoReversed)
+            evaluate(heuristic.name + "_reverse", {nodes.rbegin(), nodes.rend()}, orderSeconds);
+        evaluate(heuristic.name, std::move(nodes), orderSeconds);
+    }
+
+    choice.seconds = secondsSince(begin);
+    return choice;
+}
+
 node deleteFromVector(std::vector<node> &vec, index i) {
     assert(i < vec.size());
 
@@ -260,24 +341,62 @@ node deleteFromVector(std::vector<node> &vec, index i) {
     return movedNode;
 }
 
-Graph preprocessedGraph(const Graph &g) {
+std::vector<node> CycleReduction::expand(const std::vector<node> &cycle) const {
+    std::vector<node> expanded;
+    expanded.reserve(cycle.size());
+    for (index i = 0; i < cycle.size(); ++i) {
+        const node u = cycle[i];
+        const node previous = originalIds[cycle[i == 0 ? cycle.size() - 1 : i - 1]];
+        const auto &chain = chainNodes[u];
+        if (chain.empty()) {
+            expanded.push_back(originalIds[u]);
+        } else if (previous == chainLeft[u]) {
+            expanded.insert(expanded.end(), chain.begin(), chain.end());
+        } else {
+            assert(previous == chainRight[u]);
+            expanded.insert(expanded.end(), chain.rbegin(), chain.rend());
+        }
+    }
+    return expanded;
+}
+
+CycleReduction reduceForCycles(const Graph &g, bool compact) {
+    CycleReduction reduction;
     Graph gCopy = Graph(g);
+    // The contraction below checks for chords between the ends of every path
+    gCopy.setSortedAdjacency();
+
+    // Nodes of gCopy standing for contracted chains, stored from chainLeft to chainRight
+    std::vector<std::vector<node>> chainNodes(g.upperNodeIdBound());
+    std::vector<node> chainLeft(g.upperNodeIdBound(), none);
+    std::vector<node> chainRight(g.upperNodeIdBound(), none);
+
+    // Append the input graph nodes u stands for, entered from previous
+    auto appendExpanded = [&](std::vector<node> &out, node u, node previous) {
+        const auto &chain = chainNodes[u];
+        if (chain.empty()) {
+            out.push_back(u);
+        } else if (previous == chainLeft[u]) {
+            out.insert(out.end(), chain.begin(), chain.end());
+        } else {
+            assert(previous == chainRight[u]);
+            out.insert(out.end(), chain.rbegin(), chain.rend());
+        }
+    };
 
     auto bi_c = BiconnectedComponents(g);
     bi_c.run();
     auto res = bi_c.getComponents();
 
     // Bridges can be deleted
-    count numBridges = 0;
+    std::vector<std::pair<node, node>> bridges;
     for (auto &curComponent : res) {
         if (curComponent.size() == 2) {
-            unsigned long u = curComponent[0];
-            unsigned long v = curComponent[1];
-            gCopy.removeEdge(u, v);
-            numBridges += 1;
+            bridges.emplace_back(curComponent[0], curComponent[1]);
+            reduction.numBridges += 1;
         }
     }
-    // std::cout << "Num bridges: " << numBridges << std::endl;
+    gCopy.removeEdges(bridges.begin(), bridges.end());
 
     // Nodes with no edges can be deleted
     count M = 10000000;
@@ -285,33 +404,29 @@ Graph preprocessedGraph(const Graph &g) {
     auto degrees = std::vector<count>(gCopy.upperNodeIdBound(), M);
     auto degTwoNodes = std::vector<node>(0);
 
-    count numDegreeZeroNodes = 0;
+    std::vector<node> isolatedNodes;
     for (auto u : g.nodeRange()) {
         count currentDegree = gCopy.degree(u);
         if (currentDegree == 0) {
-            gCopy.removeNode(u);
-            numDegreeZeroNodes += 1;
+            isolatedNodes.push_back(u);
         } else if (currentDegree == 2) {
             degTwoNodes.push_back(u);
         }
         assert(currentDegree != 1);
         degrees[u] = currentDegree;
     }
+    gCopy.removeNodes(isolatedNodes.begin(), isolatedNodes.end());
 
     // As long as new degree two nodes exist, try contract and pre-enumerate
-    count numDeletedNodes = 0;
-    count numCCs = 0;
-    count numInducedPaths = 0;
     while (!degTwoNodes.empty()) {
         auto currentNode = degTwoNodes.back();
         degTwoNodes.pop_back();
 
-        if (degrees[currentNode] <= 0) {
+        if (degrees[currentNode] != 2) {
             // Node already got taken care of
             continue;
         }
 
-        assert(degrees[currentNode] == 2);
         node left = gCopy.getIthNeighbor(currentNode, 0);
         node right = gCopy.getIthNeighbor(currentNode, 1);
         assert(!((left == none) || (right == none)));
@@ -319,6 +434,8 @@ Graph preprocessedGraph(const Graph &g) {
         node preLeft = currentNode;
         node preRight = currentNode;
         std::vector<node> middleNodes = {currentNode};
+        // The middle nodes in path order are the reversed leftNodes, currentNode, rightNodes
+        std::vector<node> leftNodes, rightNodes;
 
         bool successfulExtension = true;
         bool ccFound = false;
@@ -329,6 +446,7 @@ Graph preprocessedGraph(const Graph &g) {
             } else {
                 if (degrees[left] == 2) {
                     middleNodes.push_back(left);
+                    leftNodes.push_back(left);
                     node n1 = gCopy.getIthNeighbor(left, 0);
                     node n2 = gCopy.getIthNeighbor(left, 1);
                     auto tempLeft = left;
@@ -336,6 +454,7 @@ Graph preprocessedGraph(const Graph &g) {
                     preLeft = tempLeft;
                 } else if (degrees[right] == 2) {
                     middleNodes.push_back(right);
+                    rightNodes.push_back(right);
                     node n1 = gCopy.getIthNeighbor(right, 0);
                     node n2 = gCopy.getIthNeighbor(right, 1);
                     auto tempRight = right;
@@ -347,32 +466,47 @@ Graph preprocessedGraph(const Graph &g) {
             }
         }
 
-        if (ccFound) {
-            numCCs += 1;
+        // The middle nodes from left to right, expanded to input graph nodes
+        std::vector<node> orderedMiddle(leftNodes.rbegin(), leftNodes.rend());
+        orderedMiddle.push_back(currentNode);
+        orderedMiddle.insert(orderedMiddle.end(), rightNodes.begin(), rightNodes.end());
+        std::vector<node> inner;
+        node previous = left;
+        for (auto u : orderedMiddle) {
+            appendExpanded(inner, u, previous);
+            previous = u;
+        }
 
-            for (auto v : middleNodes) {
+        if (ccFound) {
+            // The middle nodes lie on no other chordless cycle than this one
+            reduction.numCCs += 1;
+            std::vector<node> cycle;
+            appendExpanded(cycle, left, right);
+            cycle.insert(cycle.end(), inner.begin(), inner.end());
+            appendExpanded(cycle, right, orderedMiddle.back());
+            reduction.cycles.push_back(std::move(cycle));
+
+            for (auto v : middleNodes)
                 degrees[v] = 0;
-                numDeletedNodes += 1;
-                gCopy.removeNode(v);
-            }
+            gCopy.removeNodes(middleNodes.begin(), middleNodes.end());
 
-            // std::cout << "CC length: " << middleNodes.size() + 2 << std::endl;
             if ((degrees[left] == 2) && (degrees[right] == 2)) {
-                numDeletedNodes += 2;
                 degrees[left] = 0;
                 gCopy.removeNode(left);
                 degrees[right] = 0;
                 gCopy.removeNode(right);
             } else if (degrees[left] == 2) {
-                numDeletedNodes += 1;
                 degrees[left] = 0;
                 degrees[right] -= 2;
                 gCopy.removeNode(left);
+                if (degrees[right] == 2)
+                    degTwoNodes.push_back(right);
             } else if (degrees[right] == 2) {
-                numDeletedNodes += 1;
                 degrees[right] = 0;
                 degrees[left] -= 2;
                 gCopy.removeNode(right);
+                if (degrees[left] == 2)
+                    degTwoNodes.push_back(left);
             } else {
                 auto newLeftDegree = degrees[left] - 1;
                 assert(newLeftDegree != 1);
@@ -391,29 +525,64 @@ Graph preprocessedGraph(const Graph &g) {
             if (middleNodes.size() > 1) {
                 auto firstMiddleNode = middleNodes[0];
                 assert(firstMiddleNode != none);
+                std::vector<node> contracted;
                 for (auto v : middleNodes) {
                     if (v != firstMiddleNode) {
                         degrees[v] = 0;
-                        gCopy.removeNode(v);
+                        contracted.push_back(v);
+                        chainNodes[v].clear();
                     }
                 }
+                gCopy.removeNodes(contracted.begin(), contracted.end());
                 assert(degrees[firstMiddleNode] == 2);
 
-                numDeletedNodes += middleNodes.size() - 1;
-                gCopy.addEdge(left, firstMiddleNode);
-                gCopy.addEdge(right, firstMiddleNode);
-                numInducedPaths += 1;
-                // std::cout << "Tunnel length: " << middleNodes.size() + 2 << std::endl;
+                // firstMiddleNode may still be adjacent to one of the ends
+                if (!gCopy.hasEdge(left, firstMiddleNode))
+                    gCopy.addEdge(left, firstMiddleNode);
+                if (!gCopy.hasEdge(right, firstMiddleNode))
+                    gCopy.addEdge(right, firstMiddleNode);
+
+                chainNodes[firstMiddleNode] = std::move(inner);
+                chainLeft[firstMiddleNode] = left;
+                chainRight[firstMiddleNode] = right;
+                reduction.numInducedPaths += 1;
             }
         }
     }
 
+    std::unordered_map<node, node> continuousIds;
+    if (compact) {
+        continuousIds = GraphTools::getContinuousNodeIds(gCopy);
+        reduction.reducedGraph = GraphTools::getCompactedGraph(gCopy, continuousIds);
+    } else {
+        reduction.reducedGraph = gCopy;
+    }
+    reduction.originalIds.assign(reduction.reducedGraph.upperNodeIdBound(), none);
+    reduction.chainNodes.resize(reduction.reducedGraph.upperNodeIdBound());
+    reduction.chainLeft.assign(reduction.reducedGraph.upperNodeIdBound(), none);
+    reduction.chainRight.assign(reduction.reducedGraph.upperNodeIdBound(), none);
+
+    gCopy.forNodes([&](node u) {
+        const node v = compact ? continuousIds.at(u) : u;
+        reduction.originalIds[v] = u;
+        reduction.chainNodes[v] = std::move(chainNodes[u]);
+        reduction.chainLeft[v] = chainLeft[u];
+        reduction.chainRight[v] = chainRight[u];
+    });
+
+    return reduction;
+}
+
+Graph preprocessedGraph(const Graph &g) {
+    auto reduction = reduceForCycles(g);
+    const Graph &gCopy = reduction.reducedGraph;
+
     std::cout << g.numberOfNodes() << ", " << g.numberOfEdges()
               << ", " << gCopy.numberOfNodes() << ", " << gCopy.numberOfEdges()
-              << ", " << numBridges
-              << ", " << numInducedPaths
-              << ", " << numCCs;
-    return gCopy;
+              << ", " << reduction.numBridges
+              << ", " << reduction.numInducedPaths
+              << ", " << reduction.numCCs;
+    return std::move(reduction.reducedGraph);
 }
 
 Graph degTwoPreproGraph(const Graph &g) {
@@ -0,0 +1,59 @@
+#include <cassert>
+
+#include <networkit/cycles/ReachabilityMarks.hpp>
+
+namespace NetworKit {
+
+ReachabilityMarks::ReachabilityMarks(count upperNodeIdBound) : stamp(upperNodeIdBound, 0) {
+    queue.reserve(upperNodeIdBound);
+}
+
+void ReachabilityMarks::push() {
+    sets.emplace_back(trail.size(), current);
+    current = ++lastId;
+}
+
+void ReachabilityMarks::pop() {
+    assert(!sets.empty());
+    const index trailBegin = sets.back().first;
+    current = sets.back().second;
+    sets.pop_back();
+
+    while (trail.size() > trailBegin) {
+        stamp[trail.back().first] = trail.back().second;
+        trail.pop_back();
+    }
+}
+
+bool ReachabilityMarks::hasMarkedNeighbor(const Graph &G, node u) const {
+    for (node v : G.neighborRange(u)) {
+        if (isMarked(v))
+            return true;
+    }
+    return false;
+}
+
+count ReachabilityMarks::markReachable(const Graph &G, node start,
+                                       const std::vector<count> &blocked) {
+    if (stamp.size() < G.upperNodeIdBound())
+        stamp.resize(G.upperNodeIdBound(), 0);
+
+    count neighborQueries = 0;
+    queue.clear();
+    queue.push_back(start);
+    mark(start);
+
+    for (index i = 0; i < queue.size(); ++i) {
+        for (node v : G.neighborRange(queue[i])) {
+            ++neighborQueries;
+            if (blocked[v] > 0 || stamp[v] == current)
+                continue;
+            mark(v);
+            queue.push_back(v);
+        }
+    }
+
+    return neighborQueries;
+}
+
+} // namespace NetworKit
@@ -1,269 +1,564 @@
-#include <chrono>
-#include <iostream>
-#include <experimental/filesystem>
+/*
+ * benchmarkCycles: reproducible benchmark of the chordless cycle enumerations.
+ *
+ * Every combination of input graph, node order, variant and repeat is run once in counting
+ * mode and written as one record, either a CSV row or a JSON object per line, with the wall
+ * clock times of the phases and the hardware independent counters of ChordlessCyclesMetrics.
+ * Comparing the counters of two versions on the same input catches algorithmic regressions,
+ * the times catch the rest. Run with --help for the options.
+ */
 
-#include <regex>
-#include "networkit/centrality/KatzCentrality.hpp"
-#include "networkit/community/PLM.hpp"
-#include "networkit/community/PLP.hpp"
-#include "networkit/components/BiconnectedComponents.hpp"
-#include "networkit/cycles/ChordlessCyclesUno41.hpp"
-#include "networkit/cycles/PreprocessingForCycles.hpp"
-#include "networkit/io/EdgeListWriter.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <experimental/filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/auxiliary/Timer.hpp>
+#include <networkit/cycles/ChordlessCycles.hpp>
+#include <networkit/cycles/ChordlessCyclesUno.hpp>
+#include <networkit/cycles/ChordlessCyclesUno3.hpp>
+#include <networkit/cycles/ChordlessCyclesUno4.hpp>
+#include <networkit/cycles/ChordlessCyclesUno41.hpp>
+#include <networkit/cycles/PreprocessingForCycles.hpp>
+#include <networkit/generators/BarabasiAlbertGenerator.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/generators/HyperbolicGenerator.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/io/EdgeListReader.hpp>
 
-using NetworKit::Edge;
+using NetworKit::ChordlessCycles;
+using NetworKit::ChordlessCyclesMetrics;
+using NetworKit::count;
 using NetworKit::Graph;
+using NetworKit::index;
 using NetworKit::node;
 
-using std::chrono::duration;
-using std::chrono::duration_cast;
-using std::chrono::high_resolution_clock;
-using std::chrono::milliseconds;
-
 namespace fs = std::experimental::filesystem;
 
-auto timedPrepro(const std::string &name, const Graph &g) {
-    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
-    auto g_prepro = NetworKit::preprocessedGraph(g);
-    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-    auto elapsedTime = end - begin;
-    auto elapsedTimeMilliS = duration_cast<milliseconds>(elapsedTime);
-    std::cout << ", " << name << ", " << elapsedTimeMilliS.count();
-    return g_prepro;
+namespace {
+
+const char *const usageText =
+    "Usage: benchmarkCycles [options]\n"
+    "\n"
+    "Input (at least one of --graph, --corpus, --generator):\n"
+    "  --graph PATH             edge list file, may be repeated\n"
+    "  --corpus DIR             all files in DIR with extension --ext, sorted by name\n"
+    "  --ext EXT                extension of corpus files (default .el)\n"
+    "  --separator SEP          separator of edge lists: a character, 'tab' or 'space'\n"
+    "                           (default tab)\n"
+    "  --first-node ID          id of the first node in edge lists (default 0)\n"
+    "  --generator SPEC         generated graph, may be repeated; SPEC is one of\n"
+    "                             erdos-renyi:N,P\n"
+    "                             hyperbolic:N,AVGDEG[,EXP]\n"
+    "                             barabasi-albert:K,N\n"
+    "                             grid:ROWS,COLS\n"
+    "  --seed S                 seed of generators and random orders (default 42); graphs\n"
+    "                           are generated on one thread, so they only depend on the\n"
+    "                           seed. Records list n and m to tell inputs apart\n"
+    "\n"
+    "Algorithm (comma separated lists are run one after another):\n"
+    "  --variant LIST           ChordlessCycles, Uno, Uno3, Uno4, Uno41 (default Uno41)\n"
+    "  --order LIST             ids, degeneracy, degeneracy-reverse, smallest-first,\n"
+    "                           largest-first, pagerank, betweenness, random, auto\n"
+    "                           (default degeneracy)\n"
+    "  --order-seconds S        time per candidate order of 'auto' (default 1)\n"
+    "  --preprocessing MODE     none, reduce, prepro, degtwo (default none)\n"
+    "  --destructive            destructive instead of constructive enumeration\n"
+    "\n"
+    "Execution:\n"
+    "  --threads N              OpenMP threads; Uno41 runs in parallel if N > 1 (default 1)\n"
+    "  --split-branches         let idle Uno41 threads take over open branches\n"
+    "  --blocks                 Uno41 enumerates each biconnected component on its own\n"
+    "  --bidirectional          use bidirectional graph searches\n"
+    "  --max-cycles N           stop after N cycles\n"
+    "  --min-length L           Uno41 only reports cycles of at least L nodes\n"
+    "  --max-length L           Uno41 only reports cycles of at most L nodes\n"
+    "  --repeats N              runs per configuration (default 1)\n"
+    "\n"
+    "Output:\n"
+    "  --format FORMAT          csv or json (default csv)\n"
+    "  --output FILE            write records to FILE instead of stdout\n"
+    "  --help                   print this message\n";
+
+struct Options {
+    std::vector<std::string> graphs;
+    std::vector<std::string> generators;
+    std::string corpus;
+    std::string extension = ".el";
+    char separator = '\t';
+    node firstNode = 0;
+    uint64_t seed = 42;
+
+    std::vector<std::string> variants{"Uno41"};
+    std::vector<std::string> orders{"degeneracy"};
+    double orderSeconds = 1.0;
+    std::string preprocessing = "none";
+    bool constructive = true;
+
+    count threads = 1;
+    bool splitBranches = false;
+    bool blocks = false;
+    bool bidirectional = false;
+    count maxCycles = std::numeric_limits<int>::max();
+    count minLength = 3;
+    count maxLength = NetworKit::none;
+    count repeats = 1;
+
+    std::string format = "csv";
+    std::string output;
+};
+
+// One run of one configuration
+struct Record {
+    std::string graph;
+    count n;
+    count m;
+    std::string variant;
+    std::string order;
+    std::string preprocessing;
+    bool constructive;
+    count threads;
+    index repeat;
+    count cycles;
+    bool stoppedEarly;
+    double preprocessingSeconds;
+    double orderSeconds;
+    double runSeconds;
+    ChordlessCyclesMetrics metrics;
+};
+
+std::vector<std::string> split(const std::string &s, char separator) {
+    std::vector<std::string> parts;
+    std::istringstream in(s);
+    std::string part;
+    while (std::getline(in, part, separator))
+        parts.push_back(part);
+    return parts;
 }
 
-template <typename T>
-void printVector(std::vector<T> v) {
-    std::cout << "Vector of size " << v.size() << ".  ";
-    for (uint64_t i = 0; i < v.size(); i++) {
-        std::cout << i << " : " << v[i] << ", ";
+count toCount(const std::string &option, const std::string &value) {
+    try {
+        size_t end;
+        const auto result = std::stoull(value, &end);
+        if (end == value.size() && value[0] != '-')
+            return result;
+    } catch (const std::logic_error &) {
     }
-    std::cout << std::endl;
+    throw std::invalid_argument("Error: " + option + " expects a non-negative integer, got '"
+                                + value + "'");
 }
 
-template <typename T, typename U>
-void printVector(std::vector<std::pair<T, U>> v) {
-    std::cout << "Vector of size " << v.size() << ".  ";
-    for (uint64_t i = 0; i < v.size(); i++) {
-        std::cout << i << " : " << v[i].first << " " << v[i].second << ", ";
+double toDouble(const std::string &option, const std::string &value) {
+    try {
+        size_t end;
+        const auto result = std::stod(value, &end);
+        if (end == value.size())
+            return result;
+    } catch (const std::logic_error &) {
     }
-    std::cout << std::endl;
+    throw std::invalid_argument("Error: " + option + " expects a number, got '" + value + "'");
 }
 
-auto timedSmallestFirstOrder(const std::string &name, const Graph &g) {
-    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
-
-    auto nodeOrder =
-        NetworKit::fastSmallestFirstOrderedNodes(g, NetworKit::Partition(g.upperNodeIdBound(), 0));
+Options parseOptions(int argc, char *argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string option = argv[i];
 
-    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-    auto elapsedTime = end - begin;
-    auto elapsedTimeMilliS = duration_cast<milliseconds>(elapsedTime);
+        if (option == "--help") {
+            std::cout << usageText;
+            std::exit(EXIT_SUCCESS);
+        } else if (option == "--destructive") {
+            options.constructive = false;
+            continue;
+        } else if (option == "--split-branches") {
+            options.splitBranches = true;
+            continue;
+        } else if (option == "--blocks") {
+            options.blocks = true;
+            continue;
+        } else if (option == "--bidirectional") {
+            options.bidirectional = true;
+            continue;
+        }
 
-    std::cout << name << ", " << elapsedTimeMilliS.count() << std::endl;
+        if (i + 1 == argc)
+            throw std::invalid_argument("Error: unknown option or missing value: " + option);
+        const std::string value = argv[++i];
+
+        if (option == "--graph") {
+            options.graphs.push_back(value);
+        } else if (option == "--corpus") {
+            options.corpus = value;
+        } else if (option == "--ext") {
+            options.extension = value;
+        } else if (option == "--separator") {
+            if (value == "tab")
+                options.separator = '\t';
+            else if (value == "space")
+                options.separator = ' ';
+            else if (value.size() == 1)
+                options.separator = value[0];
+            else
+                throw std::invalid_argument("Error: --separator expects a single character");
+        } else if (option == "--first-node") {
+            options.firstNode = toCount(option, value);
+        } else if (option == "--generator") {
+            options.generators.push_back(value);
+        } else if (option == "--seed") {
+            options.seed = toCount(option, value);
+        } else if (option == "--variant") {
+            options.variants = split(value, ',');
+        } else if (option == "--order") {
+            options.orders = split(value, ',');
+        } else if (option == "--order-seconds") {
+            options.orderSeconds = toDouble(option, value);
+        } else if (option == "--preprocessing") {
+            options.preprocessing = value;
+        } else if (option == "--threads") {
+            options.threads = std::max<count>(1, toCount(option, value));
+        } else if (option == "--max-cycles") {
+            options.maxCycles = std::min<count>(toCount(option, value),
+                                                std::numeric_limits<unsigned int>::max());
+        } else if (option == "--min-length") {
+            options.minLength = toCount(option, value);
+        } else if (option == "--max-length") {
+            options.maxLength = toCount(option, value);
+        } else if (option == "--repeats") {
+            options.repeats = toCount(option, value);
+        } else if (option == "--format") {
+            if (value != "csv" && value != "json")
+                throw std::invalid_argument("Error: --format expects csv or json");
+            options.format = value;
+        } else if (option == "--output") {
+            options.output = value;
+        } else {
+            throw std::invalid_argument("Error: unknown option: " + option);
+        }
+    }
 
-    return nodeOrder;
+    if (options.graphs.empty() && options.corpus.empty() && options.generators.empty())
+        throw std::invalid_argument("Error: no input, see --help");
+    return options;
 }
 
-void timedEnum(const std::string &name, const Graph &g, uint64_t numCycles, bool constructive,
-               const std::vector<node> &nodeOrder, const std::string &also) {
-    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
-    NetworKit::ChordlessCyclesUno41 cc(g, nodeOrder, numCycles, constructive);
-    cc.run();
-    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-    auto elapsedTime = end - begin;
-    auto elapsedTimeMilliS = duration_cast<milliseconds>(elapsedTime);
-    auto res = cc.getChordlessCycles();
-
-    // Lengths
-    uint64_t max_length =
-        std::max_element(res.begin(), res.end(), [](const auto &u, const auto &v) {
-            return u.size() < v.size();
-        })->size();
-    std::vector<uint64_t> counts(max_length + 1, 0);
-
-    for (const auto &e : res) {
-        counts[e.size()] += 1;
-    }
-
-    std::cout << "Total: " << res.size() << ". Max length: " << max_length << ". ";
-    for (uint64_t i = 0; i < counts.size(); i++) {
-        std::cout << i << ": " << counts[i] << ", ";
+// Input graphs by name, loaded or generated one at a time
+struct Input {
+    std::string name;
+    std::string path;
+    std::string generator;
+};
+
+std::vector<Input> collectInputs(const Options &options) {
+    std::vector<Input> inputs;
+    for (const auto &path : options.graphs)
+        inputs.push_back({path, path, ""});
+
+    if (!options.corpus.empty()) {
+        std::vector<std::string> paths;
+        for (const auto &entry : fs::directory_iterator(options.corpus))
+            if (entry.path().extension() == options.extension)
+                paths.push_back(entry.path().string());
+        // Directory order is not stable across file systems
+        std::sort(paths.begin(), paths.end());
+        for (const auto &path : paths)
+            inputs.push_back({path, path, ""});
     }
-    std::cout << std::endl;
 
-    std::cout << name << ", " << numCycles << ", " << constructive << ", "
-              << elapsedTimeMilliS.count() << ", " << g.numberOfNodes() << ", " << g.numberOfEdges()
-              << ", " << also << std::endl;
+    for (const auto &spec : options.generators)
+        inputs.push_back({spec, "", spec});
+    return inputs;
 }
 
-void timedEnumReport(const std::string &name, const Graph &g, uint64_t numCycles, bool constructive,
-                     const std::vector<node> &nodeOrder, const std::string &also,
-                     const uint64_t interval) {
-
-    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
-    NetworKit::count enumCycles = 0;
-    NetworKit::ChordlessCyclesUno41 cc(
-        g,
-        [&begin, &enumCycles, &interval](const std::vector<node> &p) {
-            enumCycles += 1;
-            if (enumCycles % interval == 0) {
-                std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-                auto elapsedTime = end - begin;
-                auto elapsedTimeMilliS = duration_cast<milliseconds>(elapsedTime);
-                std::cout << enumCycles << ", " << elapsedTimeMilliS.count() << std::endl;
-            }
-            return true;
-        },
-        nodeOrder, numCycles, constructive);
-
-    cc.run();
-    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-    auto elapsedTime = end - begin;
-    auto elapsedTimeMilliS = duration_cast<milliseconds>(elapsedTime);
-
-    std::cout << std::endl;
-
-    std::cout << name << ", " << numCycles << ", " << constructive << ", "
-              << elapsedTimeMilliS.count() << ", " << g.numberOfNodes() << ", " << g.numberOfEdges()
-              << ", " << also << std::endl;
+Graph gridGraph(count rows, count cols) {
+    Graph g(rows * cols);
+    for (index r = 0; r < rows; ++r) {
+        for (index c = 0; c < cols; ++c) {
+            const node u = r * cols + c;
+            if (c + 1 < cols)
+                g.addEdge(u, u + 1);
+            if (r + 1 < rows)
+                g.addEdge(u, u + cols);
+        }
+    }
+    return g;
 }
 
-std::vector<std::string> collectGraphs(const std::string &path, bool original = false) {
-    std::vector<std::string> graphs;
-
-    for (const auto &entry : fs::directory_iterator(path)) {
-        const fs::path &filePath(entry);
-        if ((filePath.extension() == ".el")) {
-            if (original && (filePath.string().find("bbicon") == std::string::npos)
-                && (filePath.string().find("prep") == std::string::npos)) {
-                graphs.push_back(entry.path());
-            }
-            if (!original && (filePath.string().find("bbicon") != std::string::npos)) {
-                graphs.push_back(entry.path());
-            }
-        }
+Graph generateModel(const std::string &spec, uint64_t seed) {
+    const auto colon = spec.find(':');
+    const std::string model = spec.substr(0, colon);
+    const auto params = colon == std::string::npos ? std::vector<std::string>()
+                                                   : split(spec.substr(colon + 1), ',');
+    auto param = [&](index i) -> const std::string & {
+        if (i >= params.size())
+            throw std::invalid_argument("Error: missing parameter of generator " + spec);
+        return params[i];
+    };
+
+    // Generators draw from the global random number generator
+    Aux::Random::setSeed(seed, false);
+    if (model == "erdos-renyi") {
+        return NetworKit::ErdosRenyiGenerator(toCount(spec, param(0)), toDouble(spec, param(1)))
+            .generate();
+    } else if (model == "hyperbolic") {
+        const double exp = params.size() > 2 ? toDouble(spec, param(2)) : 3.;
+        return NetworKit::HyperbolicGenerator(toCount(spec, param(0)), toDouble(spec, param(1)),
+                                              exp)
+            .generate();
+    } else if (model == "barabasi-albert") {
+        return NetworKit::BarabasiAlbertGenerator(toCount(spec, param(0)),
+                                                  toCount(spec, param(1)))
+            .generate();
+    } else if (model == "grid") {
+        return gridGraph(toCount(spec, param(0)), toCount(spec, param(1)));
     }
-    return graphs;
+    throw std::invalid_argument("Error: unknown generator " + model);
 }
 
-/*
- * Sorry, because of last minute changes this is somewhat messy
- */
-int main(int argc, char *argv[]) {
+Graph generateGraph(const std::string &spec, uint64_t seed) {
+    // The threads of the parallel generators share one random stream, so the graph would
+    // depend on the number of threads
+    const int threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    try {
+        Graph g = generateModel(spec, seed);
+        omp_set_num_threads(threads);
+        return g;
+    } catch (...) {
+        omp_set_num_threads(threads);
+        throw;
+    }
+}
 
+Graph loadGraph(const Input &input, const Options &options) {
+    Graph g;
+    if (input.generator.empty()) {
+        NetworKit::EdgeListReader reader(options.separator, options.firstNode, "#");
+        g = reader.read(input.path);
+    } else {
+        g = generateGraph(input.generator, options.seed);
+    }
 
-    NetworKit::EdgeListReader r('\t', 0, "#");
-    NetworKit::EdgeListWriter w(' ', 0);
+    if (g.numberOfSelfLoops() > 0)
+        g.removeSelfLoops();
+    g.removeMultiEdges();
+    g.shrinkToFit();
+    g.sortEdges();
+    g.indexEdges();
+    return g;
+}
 
-    std::string smallPaths = "/home/";
-    std::string mediumPaths = "/home/";
-    std::string largePaths = "/home/";
-    std::string micpPaths = "/home/";
+// Returns the graph to enumerate and adds the cycles found while preprocessing to @a cycles
+Graph preprocess(const Graph &g, const std::string &mode, count &cycles) {
+    if (mode == "none") {
+        return g;
+    } else if (mode == "reduce") {
+        auto reduction = NetworKit::reduceForCycles(g, true);
+        cycles += reduction.cycles.size();
+        return std::move(reduction.reducedGraph);
+    } else if (mode == "prepro") {
+        return NetworKit::preprocessedGraph(g);
+    } else if (mode == "degtwo") {
+        return NetworKit::degTwoPreproGraph(g);
+    }
+    throw std::invalid_argument("Error: unknown preprocessing " + mode);
+}
 
-    std::vector<std::string> smallGraphsOrig = collectGraphs(smallPaths, true);
-    std::vector<std::string> mediumGraphsOrig = collectGraphs(mediumPaths, true);
-    std::vector<std::string> largeGraphsOrig = collectGraphs(largePaths, true);
-    std::vector<std::string> micpGraphsOrig = collectGraphs(micpPaths, true);
+std::vector<node> computeOrder(const Graph &g, const std::string &order,
+                               const Options &options) {
+    if (order == "ids") {
+        std::vector<node> nodes;
+        nodes.reserve(g.numberOfNodes());
+        g.forNodes([&](node u) { nodes.push_back(u); });
+        return nodes;
+    } else if (order == "degeneracy") {
+        return NetworKit::degeneracyOrderedNodes(g);
+    } else if (order == "degeneracy-reverse") {
+        auto nodes = NetworKit::degeneracyOrderedNodes(g);
+        std::reverse(nodes.begin(), nodes.end());
+        return nodes;
+    } else if (order == "smallest-first") {
+        return NetworKit::smallestFirstOrderedNodes(g);
+    } else if (order == "largest-first") {
+        return NetworKit::largestFirstOrderedNodes(g);
+    } else if (order == "pagerank") {
+        return NetworKit::pageRankOrderedNodes(g);
+    } else if (order == "betweenness") {
+        return NetworKit::betweennessOrderedNodes(g);
+    } else if (order == "random") {
+        return NetworKit::randomOrderedNodes(g, static_cast<int>(options.seed));
+    } else if (order == "auto") {
+        return NetworKit::selectNodeOrder(g, options.constructive, options.orderSeconds,
+                                          options.threads > 1)
+            .order;
+    }
+    throw std::invalid_argument("Error: unknown order " + order);
+}
 
-    std::vector<std::string> smallGraphsPre = collectGraphs(smallPaths, false);
-    std::vector<std::string> mediumGraphsPre = collectGraphs(mediumPaths, false);
-    std::vector<std::string> largeGraphsPre = collectGraphs(largePaths, false);
+std::unique_ptr<ChordlessCycles> createVariant(const std::string &variant, const Graph &g,
+                                               const std::vector<node> &order,
+                                               const Options &options) {
+    const auto maxCycles = static_cast<unsigned int>(options.maxCycles);
+    std::unique_ptr<ChordlessCycles> cc;
+    if (variant == "ChordlessCycles") {
+        cc.reset(new ChordlessCycles(g, order, maxCycles, options.constructive));
+    } else if (variant == "Uno") {
+        cc.reset(new NetworKit::ChordlessCyclesUno(g, order, maxCycles, options.constructive));
+    } else if (variant == "Uno3") {
+        cc.reset(new NetworKit::ChordlessCyclesUno3(g, order, maxCycles, options.constructive));
+    } else if (variant == "Uno4") {
+        cc.reset(new NetworKit::ChordlessCyclesUno4(g, order, maxCycles, options.constructive));
+    } else if (variant == "Uno41") {
+        auto uno41 = new NetworKit::ChordlessCyclesUno41(g, order, maxCycles,
+                                                         options.constructive);
+        cc.reset(uno41);
+        uno41->setParallel(options.threads > 1, options.splitBranches);
+        uno41->setBlockDecomposition(options.blocks);
+        if (options.minLength != 3 || options.maxLength != NetworKit::none)
+            uno41->setLengthBounds(options.minLength, options.maxLength);
+    } else {
+        throw std::invalid_argument("Error: unknown variant " + variant);
+    }
 
-    std::vector<std::pair<std::string, uint64_t>> origExperiments;
-    std::vector<std::pair<std::string, uint64_t>> preExperiments;
+    cc->setCountingOnly();
+    cc->setBidirectional(options.bidirectional);
+    return cc;
+}
 
-    for (auto &p : smallGraphsOrig) {
-        origExperiments.emplace_back(p, 4000000);
-    }
-    for (auto &p : mediumGraphsOrig) {
-        break;
-        origExperiments.emplace_back(p, 4000000);
-    }
-    for (auto &p : largeGraphsOrig) {
-        break;
-        origExperiments.emplace_back(p, 5000);
+std::string csvField(const std::string &s) {
+    if (s.find_first_of(",\"\n") == std::string::npos)
+        return s;
+    std::string quoted = "\"";
+    for (auto c : s) {
+        if (c == '"')
+            quoted += '"';
+        quoted += c;
     }
+    return quoted + "\"";
+}
 
-    for (auto &p : smallGraphsPre) {
-        preExperiments.emplace_back(p, 4000000);
-    }
-    for (auto &p : mediumGraphsPre) {
-        break;
-        preExperiments.emplace_back(p, 4000000);
-    }
-    for (auto &p : largeGraphsPre) {
-        break;
-        preExperiments.emplace_back(p, 5000);
+std::string jsonString(const std::string &s) {
+    std::string escaped = "\"";
+    for (auto c : s) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
     }
-    for (auto &p : micpGraphsOrig) {
-        break;
-        preExperiments.emplace_back(p, 4000000);
-    }
-
-    printVector(origExperiments);
-    printVector(preExperiments);
-
-    if (true) {
-        for (const auto &exp : origExperiments) {
-            auto graphPath = exp.first;
-            auto numCycles = exp.second;
+    return escaped + "\"";
+}
 
-            if (graphPath.find("polbooks") == std::string::npos)
-                continue;
+void writeCsvHeader(std::ostream &os) {
+    os << "graph,n,m,variant,order,preprocessing,direction,threads,repeat,cycles,stoppedEarly,"
+          "preprocessingSeconds,orderSeconds,runSeconds,outerLoops,innerLoops,treeNodes,leafs,"
+          "bfsCalls,unsuccessfulBfsCalls,bfsNeighborQueries,bidirectionalBfsCalls,"
+          "enumerationSeconds,bfsSeconds,recursionSeconds\n";
+}
 
-            std::cout << "---  " << graphPath << "  ---" << std::endl;
+void writeCsv(std::ostream &os, const Record &r) {
+    const auto &metrics = r.metrics;
+    os << csvField(r.graph) << ',' << r.n << ',' << r.m << ',' << r.variant << ','
+       << r.order << ',' << r.preprocessing << ','
+       << (r.constructive ? "constructive" : "destructive") << ',' << r.threads << ','
+       << r.repeat << ',' << r.cycles << ',' << r.stoppedEarly << ',' << r.preprocessingSeconds
+       << ',' << r.orderSeconds << ',' << r.runSeconds << ',' << metrics.outerLoops << ','
+       << metrics.innerLoops << ',' << metrics.treeNodes << ',' << metrics.leafs << ','
+       << metrics.bfsCalls << ',' << metrics.unsuccessfulBfsCalls << ','
+       << metrics.bfsNeighborQueries << ',' << metrics.bidirectionalBfsCalls << ','
+       << metrics.enumerationSeconds << ',' << metrics.bfsSeconds() << ','
+       << metrics.recursionSeconds() << '\n';
+}
 
-            Graph g = r.read(graphPath);
-            g.shrinkToFit();
-            g.sortEdges();
-            g.indexEdges();
+void writeJson(std::ostream &os, const Record &r) {
+    os << "{\"graph\": " << jsonString(r.graph) << ", \"n\": " << r.n << ", \"m\": " << r.m
+       << ", \"variant\": " << jsonString(r.variant) << ", \"order\": " << jsonString(r.order)
+       << ", \"preprocessing\": " << jsonString(r.preprocessing) << ", \"direction\": "
+       << jsonString(r.constructive ? "constructive" : "destructive")
+       << ", \"threads\": " << r.threads << ", \"repeat\": " << r.repeat
+       << ", \"cycles\": " << r.cycles
+       << ", \"stoppedEarly\": " << (r.stoppedEarly ? "true" : "false")
+       << ", \"preprocessingSeconds\": " << r.preprocessingSeconds
+       << ", \"orderSeconds\": " << r.orderSeconds << ", \"runSeconds\": " << r.runSeconds
+       << ", \"metrics\": " << r.metrics.toJson() << "}\n";
+}
 
-            for (auto i : {0, 1, 2, 3, 4}) {
-                timedEnum(graphPath, g, numCycles, false, NetworKit::randomOrderedNodes(g, i),
-                          "random, " + std::to_string(i));
+void runBenchmark(const Options &options, std::ostream &os) {
+    const bool json = options.format == "json";
+    if (!json)
+        writeCsvHeader(os);
+
+    for (const auto &input : collectInputs(options)) {
+        const Graph original = loadGraph(input, options);
+
+        Aux::StartedTimer timer;
+        count preprocessingCycles = 0;
+        const Graph g = preprocess(original, options.preprocessing, preprocessingCycles);
+        const double preprocessingSeconds = timer.elapsedNanoseconds() * 1e-9;
+
+        for (const auto &orderName : options.orders) {
+            timer.start();
+            const auto order = computeOrder(g, orderName, options);
+            const double orderSeconds = timer.elapsedNanoseconds() * 1e-9;
+
+            for (const auto &variant : options.variants) {
+                for (index repeat = 0; repeat < options.repeats; ++repeat) {
+                    auto cc = createVariant(variant, g, order, options);
+                    timer.start();
+                    cc->run();
+                    const double runSeconds = timer.elapsedNanoseconds() * 1e-9;
+
+                    Record record{input.name,
+                                  original.numberOfNodes(),
+                                  original.numberOfEdges(),
+                                  variant,
+                                  orderName,
+                                  options.preprocessing,
+                                  options.constructive,
+                                  options.threads,
+                                  repeat,
+                                  cc->numberOfCycles() + preprocessingCycles,
+                                  cc->stoppedEarly(),
+                                  preprocessingSeconds,
+                                  orderSeconds,
+                                  runSeconds,
+                                  cc->getMetrics()};
+                    if (json)
+                        writeJson(os, record);
+                    else
+                        writeCsv(os, record);
+                    os.flush();
+                }
             }
         }
     }
+}
 
-    std::reverse(preExperiments.begin(), preExperiments.end());
-    for (const auto &exp : preExperiments) {
-        auto graphPath = exp.first;
-        auto numCycles = exp.second;
-
-        if (graphPath.find("polbooks") == std::string::npos)
-            continue;
-
-        std::cout << "---  " << graphPath << "  ---" << std::endl;
-
-        Graph g = r.read(graphPath);
-        g.shrinkToFit();
-        g.sortEdges();
-        g.indexEdges();
-
-        auto smallestFirstNodeOrder = timedSmallestFirstOrder(graphPath, g);
-        std::vector<node> smallestFirstReverseNodeOrder(smallestFirstNodeOrder.rbegin(),
-                                                        smallestFirstNodeOrder.rend());
-
-
-
-        timedEnum(graphPath, g, numCycles, true, smallestFirstReverseNodeOrder,
-                  "smallest_first, reverse");
-
-        continue ;
-
-        timedEnum(graphPath, g, numCycles, false, smallestFirstReverseNodeOrder,
-                  "smallest_first, reverse");
+} // namespace
 
-        for (auto i : {0, 1, 2}) {
-            timedEnum(graphPath, g, numCycles, false, NetworKit::randomOrderedNodes(g, i),
-                      "random, " + std::to_string(i));
-            timedEnum(graphPath, g, numCycles, true, NetworKit::randomOrderedNodes(g, i),
-                      "random, " + std::to_string(i));
+int main(int argc, char *argv[]) {
+    try {
+        const auto options = parseOptions(argc, argv);
+        omp_set_num_threads(static_cast<int>(options.threads));
+
+        if (options.output.empty()) {
+            runBenchmark(options, std::cout);
+        } else {
+            std::ofstream out(options.output);
+            if (!out)
+                throw std::runtime_error("Error: cannot open " + options.output);
+            runBenchmark(options, out);
         }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
     }
-
-
+    return EXIT_SUCCESS;
 }
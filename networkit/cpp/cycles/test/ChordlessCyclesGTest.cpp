@@ -0,0 +1,933 @@
+#include <algorithm>
+#include <csignal>
+#include <cstdio>
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+#include <networkit/GlobalState.hpp>
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/cycles/BlockedBFS.hpp>
+#include <networkit/cycles/ChordlessCycles.hpp>
+#include <networkit/cycles/ChordlessCyclesMetrics.hpp>
+#include <networkit/cycles/ChordlessCyclesUno.hpp>
+#include <networkit/cycles/ChordlessCyclesUno3.hpp>
+#include <networkit/cycles/ChordlessCyclesUno4.hpp>
+#include <networkit/cycles/ChordlessCyclesUno41.hpp>
+#include <networkit/cycles/CycleStore.hpp>
+#include <networkit/cycles/DynChordlessCycles.hpp>
+#include <networkit/cycles/PreprocessingForCycles.hpp>
+#include <networkit/cycles/ReachabilityMarks.hpp>
+#include <networkit/dynamics/GraphEvent.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+
+namespace NetworKit {
+
+class ChordlessCyclesGTest : public testing::Test {
+protected:
+    // Rotate every cycle to start at its smallest node and orient it such that the
+    // second node is smaller than the last one; then sort the whole collection.
+    static std::vector<std::vector<node>> canonical(std::vector<std::vector<node>> cycles) {
+        for (auto &cycle : cycles) {
+            std::rotate(cycle.begin(), std::min_element(cycle.begin(), cycle.end()), cycle.end());
+            if (cycle.size() > 2 && cycle[1] > cycle.back())
+                std::reverse(cycle.begin() + 1, cycle.end());
+        }
+        std::sort(cycles.begin(), cycles.end());
+        return cycles;
+    }
+
+    template <typename Algo>
+    static std::vector<std::vector<node>> enumerate(const Graph &G, bool constructive = true) {
+        std::vector<node> order;
+        G.forNodes([&](node u) { order.push_back(u); });
+        Algo algo(G, order, std::numeric_limits<int>::max(), constructive);
+        algo.run();
+        return canonical(algo.getChordlessCycles());
+    }
+
+    static Graph wheel(count spokes) {
+        Graph G(spokes + 1);
+        for (node u = 0; u < spokes; ++u) {
+            G.addEdge(u, (u + 1) % spokes);
+            G.addEdge(u, spokes);
+        }
+        return G;
+    }
+};
+
+TEST_F(ChordlessCyclesGTest, testBlockedBFS) {
+    // 0 - 1 - 2 - 3 and the detour 0 - 4 - 5 - 6 - 3
+    Graph G(7);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    G.addEdge(2, 3);
+    G.addEdge(0, 4);
+    G.addEdge(4, 5);
+    G.addEdge(5, 6);
+    G.addEdge(6, 3);
+
+    BlockedBFS bfs(G.upperNodeIdBound());
+    std::vector<count> blocked(G.upperNodeIdBound(), 0);
+    EXPECT_TRUE(bfs.run(G, 0, &blocked, 3));
+    EXPECT_EQ(bfs.getPath(3), std::vector<node>({0, 1, 2, 3}));
+    EXPECT_EQ(bfs.getPath(3, false), std::vector<node>({3, 2, 1, 0}));
+
+    // reusing the workspace must not leak marks of the previous search
+    blocked[2] = 1;
+    EXPECT_TRUE(bfs.run(G, 0, &blocked, 3));
+    EXPECT_EQ(bfs.getPath(3), std::vector<node>({0, 4, 5, 6, 3}));
+    EXPECT_FALSE(bfs.isReached(2));
+
+    blocked[5] = 1;
+    EXPECT_FALSE(bfs.run(G, 0, &blocked, 3));
+    EXPECT_TRUE(bfs.getPath(3).empty());
+    EXPECT_EQ(bfs.numberOfReachedNodes(), 3);
+
+    bfs.run(G, 0);
+    EXPECT_EQ(bfs.numberOfReachedNodes(), 7);
+}
+
+TEST_F(ChordlessCyclesGTest, testBlockedBFSBidirectional) {
+    // 0 - 1 - 2 - 3 and the detour 0 - 4 - 5 - 6 - 3
+    Graph G(7);
+    G.addEdge(0, 1);
+    G.addEdge(1, 2);
+    G.addEdge(2, 3);
+    G.addEdge(0, 4);
+    G.addEdge(4, 5);
+    G.addEdge(5, 6);
+    G.addEdge(6, 3);
+
+    BlockedBFS bfs(G.upperNodeIdBound());
+    std::vector<count> blocked(G.upperNodeIdBound(), 0);
+    EXPECT_TRUE(bfs.runBidirectional(G, 0, 3, &blocked));
+    EXPECT_EQ(bfs.getPath(3), std::vector<node>({0, 1, 2, 3}));
+    EXPECT_EQ(bfs.getPath(3, false), std::vector<node>({3, 2, 1, 0}));
+
+    blocked[2] = 1;
+    EXPECT_TRUE(bfs.runBidirectional(G, 0, 3, &blocked));
+    EXPECT_EQ(bfs.getPath(3), std::vector<node>({0, 4, 5, 6, 3}));
+    EXPECT_FALSE(bfs.isReached(2));
+
+    blocked[5] = 1;
+    EXPECT_FALSE(bfs.runBidirectional(G, 0, 3, &blocked));
+    EXPECT_TRUE(bfs.getPath(3).empty());
+
+    // alternating with unidirectional searches on the same workspace
+    EXPECT_FALSE(bfs.run(G, 0, &blocked, 3));
+    EXPECT_TRUE(bfs.runBidirectional(G, 3, 0));
+    EXPECT_EQ(bfs.getPath(0), std::vector<node>({3, 2, 1, 0}));
+}
+
+TEST_F(ChordlessCyclesGTest, testReachabilityMarks) {
+    // path 0 - 1 - 2 - 3 - 4
+    Graph G(5);
+    for (node u = 0; u < 4; ++u)
+        G.addEdge(u, u + 1);
+
+    ReachabilityMarks marks;
+    std::vector<count> blocked(G.upperNodeIdBound(), 0);
+    blocked[2] = 1;
+
+    marks.push();
+    marks.markReachable(G, 0, blocked);
+    EXPECT_TRUE(marks.isMarked(0));
+    EXPECT_TRUE(marks.isMarked(1));
+    EXPECT_FALSE(marks.isMarked(2));
+    EXPECT_TRUE(marks.hasMarkedNeighbor(G, 2));
+
+    // a nested set starts empty and leaves the outer one intact
+    marks.push();
+    EXPECT_FALSE(marks.isMarked(0));
+    marks.markReachable(G, 1, blocked);
+    marks.markReachable(G, 4, blocked);
+    EXPECT_TRUE(marks.isMarked(3));
+    marks.clear();
+    EXPECT_FALSE(marks.isMarked(3));
+    marks.markReachable(G, 3, blocked);
+    marks.pop();
+
+    EXPECT_TRUE(marks.isMarked(0));
+    EXPECT_TRUE(marks.isMarked(1));
+    EXPECT_FALSE(marks.isMarked(3));
+
+    // growing the outer set once 2 is available again skips the marked nodes
+    blocked[2] = 0;
+    EXPECT_EQ(marks.markReachable(G, 2, blocked), 5);
+    for (node u = 0; u < 5; ++u)
+        EXPECT_TRUE(marks.isMarked(u));
+    marks.pop();
+}
+
+TEST_F(ChordlessCyclesGTest, testCycleStore) {
+    const std::vector<std::vector<node>> cycles = {
+        {0, 1, 2}, {7, 3, 1000000, 5}, {node{1} << 40, 2, (node{1} << 40) + 1}};
+
+    for (bool compressed : {false, true}) {
+        CycleStore store(compressed);
+        for (const auto &cycle : cycles)
+            store.add(cycle);
+
+        ASSERT_EQ(store.size(), 3);
+        EXPECT_EQ(store.numberOfNodes(), 10);
+        EXPECT_EQ(store.getCycle(1), cycles[1]);
+
+        std::vector<std::vector<node>> stored;
+        store.forCycles([&](const std::vector<node> &cycle) { stored.push_back(cycle); });
+        EXPECT_EQ(stored, cycles);
+
+        store.clear();
+        EXPECT_EQ(store.size(), 0);
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testCompactStorageAndOutputFile) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(20, 0.25).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    ChordlessCyclesUno41 plain(G, order);
+    plain.run();
+    const auto &expected = plain.getChordlessCycles();
+
+    auto toVectors = [](const CycleStore &store) {
+        std::vector<std::vector<node>> cycles;
+        store.forCycles([&](const std::vector<node> &cycle) { cycles.push_back(cycle); });
+        return cycles;
+    };
+
+    for (bool compressed : {false, true}) {
+        ChordlessCyclesUno41 compact(G, order);
+        compact.setCompactStorage(compressed);
+        compact.run();
+        EXPECT_EQ(compact.numberOfCycles(), expected.size());
+        EXPECT_EQ(toVectors(compact.getCycleStore()), expected);
+        EXPECT_THROW(compact.getChordlessCycles(), std::runtime_error);
+    }
+
+    // Parallel workers write to the same file as they find cycles
+    const std::string path = "ChordlessCyclesGTest.cycles";
+    for (bool parallel : {false, true}) {
+        for (bool blocks : {false, true}) {
+            ChordlessCyclesUno41 streamed(G, order);
+            streamed.setParallel(parallel);
+            streamed.setBlockDecomposition(blocks);
+            // tiny chunks to exercise the intermediate writes
+            streamed.setOutputFile(path, 16);
+            streamed.run();
+            EXPECT_EQ(streamed.numberOfCycles(), expected.size());
+            EXPECT_EQ(streamed.getLengthHistogram(), plain.getLengthHistogram());
+            EXPECT_EQ(canonical(toVectors(readCycleStream(path))), canonical(expected));
+
+            ChordlessCyclesUno41 limited(G, order, 10);
+            limited.setParallel(parallel);
+            limited.setBlockDecomposition(blocks);
+            limited.setOutputFile(path, 16);
+            limited.run();
+            EXPECT_EQ(limited.numberOfCycles(), count{10});
+            EXPECT_EQ(readCycleStream(path).size(), count{10});
+        }
+    }
+    std::remove(path.c_str());
+}
+
+TEST_F(ChordlessCyclesGTest, testCheckpointResume) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.15).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    auto readCycles = [](const std::string &path) {
+        std::vector<std::vector<node>> cycles;
+        readCycleStream(path).forCycles(
+            [&](const std::vector<node> &cycle) { cycles.push_back(cycle); });
+        return canonical(cycles);
+    };
+
+    const std::string expectedPath = "ChordlessCyclesGTest.expected.cycles";
+    const std::string path = "ChordlessCyclesGTest.resumed.cycles";
+    const std::string checkpoint = "ChordlessCyclesGTest.checkpoint";
+    for (bool constructive : {true, false}) {
+        ChordlessCyclesUno41 full(G, order, std::numeric_limits<int>::max(), constructive);
+        full.setOutputFile(expectedPath, 16);
+        full.run();
+        ASSERT_GT(full.numberOfCycles(), 40);
+
+        // Interrupted by the limit; every outer loop saves a checkpoint. The resumed run
+        // visits neighbors in another order, so only the sets of cycles agree.
+        ChordlessCyclesUno41 interrupted(G, order, 40, constructive);
+        interrupted.setOutputFile(path, 16);
+        interrupted.setCheckpointFile(checkpoint, 0);
+        interrupted.run();
+        EXPECT_TRUE(interrupted.stoppedEarly());
+
+        ChordlessCyclesUno41 resumed(G, order, std::numeric_limits<int>::max(), constructive);
+        resumed.setOutputFile(path, 16);
+        resumed.setCheckpointFile(checkpoint, 0);
+        resumed.resumeFrom(checkpoint);
+        resumed.run();
+        EXPECT_FALSE(resumed.stoppedEarly());
+        EXPECT_EQ(resumed.numberOfCycles(), full.numberOfCycles());
+        EXPECT_EQ(resumed.getLengthHistogram(), full.getLengthHistogram());
+        EXPECT_EQ(readCycles(path), readCycles(expectedPath));
+
+        // Resuming a finished run finds nothing new
+        ChordlessCyclesUno41 finished(G, order, std::numeric_limits<int>::max(), constructive);
+        finished.resumeFrom(checkpoint);
+        finished.run();
+        EXPECT_EQ(finished.numberOfCycles(), full.numberOfCycles());
+        EXPECT_TRUE(finished.getChordlessCycles().empty());
+    }
+
+    std::vector<node> reversed(order.rbegin(), order.rend());
+    ChordlessCyclesUno41 otherOrder(G, reversed);
+    otherOrder.resumeFrom(checkpoint);
+    EXPECT_THROW(otherOrder.run(), std::runtime_error);
+
+    // Same numbers of nodes and edges, but one edge moved
+    const auto moved = *G.edgeRange().begin();
+    Graph rewired(G);
+    rewired.removeEdge(moved.u, moved.v);
+    for (node v = 1; rewired.numberOfEdges() < G.numberOfEdges(); ++v)
+        if (!G.hasEdge(0, v))
+            rewired.addEdge(0, v);
+    ChordlessCyclesUno41 otherEdges(rewired, order);
+    otherEdges.resumeFrom(checkpoint);
+    EXPECT_THROW(otherEdges.run(), std::runtime_error);
+
+    ChordlessCyclesUno41 withCallback(
+        G, [](const std::vector<node> &) { return true; }, order);
+    EXPECT_THROW(withCallback.resumeFrom(checkpoint), std::runtime_error);
+
+    ChordlessCyclesUno41 parallel(G, order);
+    parallel.setParallel(true);
+    parallel.setCheckpointFile(checkpoint);
+    EXPECT_THROW(parallel.run(), std::runtime_error);
+
+    std::remove(expectedPath.c_str());
+    std::remove(path.c_str());
+    std::remove(checkpoint.c_str());
+}
+
+TEST_F(ChordlessCyclesGTest, testDynChordlessCycles) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(25, 0.2).generate();
+    DynChordlessCycles dyn(G);
+    dyn.run();
+    EXPECT_EQ(canonical(dyn.getChordlessCycles()), enumerate<ChordlessCyclesUno41>(G));
+
+    auto randomEvent = [&]() {
+        const node u = Aux::Random::integer(G.upperNodeIdBound() - 1);
+        node v = Aux::Random::integer(G.upperNodeIdBound() - 2);
+        if (v >= u)
+            ++v;
+        if (G.hasEdge(u, v)) {
+            G.removeEdge(u, v);
+            return GraphEvent(GraphEvent::EDGE_REMOVAL, u, v);
+        }
+        G.addEdge(u, v);
+        return GraphEvent(GraphEvent::EDGE_ADDITION, u, v);
+    };
+
+    // Each update turns the old cycles into the new ones by its removed and added cycles
+    for (int step = 0; step < 40; ++step) {
+        auto expected = canonical(dyn.getChordlessCycles());
+        dyn.update(randomEvent());
+        for (const auto &cycle : canonical(dyn.getRemovedCycles()))
+            expected.erase(std::find(expected.begin(), expected.end(), cycle));
+        const auto added = canonical(dyn.getAddedCycles());
+        expected.insert(expected.end(), added.begin(), added.end());
+        EXPECT_EQ(canonical(expected), enumerate<ChordlessCyclesUno41>(G));
+        EXPECT_EQ(dyn.numberOfCycles(), expected.size());
+    }
+
+    // The events of a batch are applied to the graph before the update
+    std::vector<GraphEvent> batch;
+    for (int i = 0; i < 20; ++i)
+        batch.push_back(randomEvent());
+    dyn.updateBatch(batch);
+    EXPECT_EQ(canonical(dyn.getChordlessCycles()), enumerate<ChordlessCyclesUno41>(G));
+}
+
+TEST_F(ChordlessCyclesGTest, testMetrics) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.15).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    ChordlessCyclesUno41 sequential(G, order);
+    testing::internal::CaptureStdout();
+    sequential.run();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+    const auto &metrics = sequential.getMetrics();
+    EXPECT_EQ(metrics.outerLoops, G.numberOfNodes());
+    EXPECT_EQ(metrics.cycles, sequential.numberOfCycles());
+    EXPECT_GT(metrics.treeNodes, metrics.cycles);
+    EXPECT_GT(metrics.bfsCalls, ChordlessCyclesMetrics::sampleInterval);
+    EXPECT_GT(metrics.timedBfsCalls, 0);
+    EXPECT_GE(metrics.bfsSeconds(), 0);
+    EXPECT_EQ(metrics.threads, 1);
+
+    // Every worker counts on its own; the merged counters match the sequential run
+    for (bool blocks : {false, true}) {
+        ChordlessCyclesUno41 parallel(G, order);
+        parallel.setParallel(true);
+        parallel.setBlockDecomposition(blocks);
+        parallel.run();
+        const auto &merged = parallel.getMetrics();
+        EXPECT_EQ(merged.cycles, metrics.cycles);
+        EXPECT_GT(merged.treeNodes, merged.cycles);
+        if (!blocks) {
+            EXPECT_EQ(merged.outerLoops, metrics.outerLoops);
+        }
+    }
+
+    // A second run starts from zero
+    sequential.run();
+    EXPECT_EQ(sequential.getMetrics().outerLoops, G.numberOfNodes());
+
+    const auto json = metrics.toJson();
+    EXPECT_EQ(json.front(), '{');
+    EXPECT_EQ(json.back(), '}');
+    EXPECT_NE(json.find("\"treeNodes\": " + std::to_string(metrics.treeNodes)), std::string::npos);
+}
+
+TEST_F(ChordlessCyclesGTest, testCycleGraph) {
+    Graph G(7);
+    for (node u = 0; u < 7; ++u)
+        G.addEdge(u, (u + 1) % 7);
+
+    auto cycles = enumerate<ChordlessCyclesUno41>(G);
+    ASSERT_EQ(cycles.size(), 1);
+    EXPECT_EQ(cycles[0].size(), 7);
+}
+
+TEST_F(ChordlessCyclesGTest, testWheel) {
+    const Graph G = wheel(6);
+
+    auto cycles = enumerate<ChordlessCyclesUno41>(G);
+    // six triangles through the hub plus the outer rim
+    ASSERT_EQ(cycles.size(), 7);
+    EXPECT_EQ(std::count_if(cycles.begin(), cycles.end(),
+                            [](const std::vector<node> &c) { return c.size() == 3; }),
+              6);
+}
+
+TEST_F(ChordlessCyclesGTest, testCompleteBipartite) {
+    Graph G(6);
+    for (node u = 0; u < 3; ++u)
+        for (node v = 3; v < 6; ++v)
+            G.addEdge(u, v);
+
+    auto cycles = enumerate<ChordlessCyclesUno41>(G);
+    EXPECT_EQ(cycles.size(), 9);
+    for (const auto &cycle : cycles)
+        EXPECT_EQ(cycle.size(), 4);
+}
+
+TEST_F(ChordlessCyclesGTest, testVariantsAgreeOnRandomGraphs) {
+    Aux::Random::setSeed(42, false);
+    for (int i = 0; i < 5; ++i) {
+        const Graph G = ErdosRenyiGenerator(14, 0.3).generate();
+
+        const auto expected = enumerate<ChordlessCycles>(G);
+        EXPECT_EQ(enumerate<ChordlessCyclesUno3>(G), expected);
+        EXPECT_EQ(enumerate<ChordlessCyclesUno4>(G), expected);
+        EXPECT_EQ(enumerate<ChordlessCyclesUno41>(G), expected);
+        EXPECT_EQ(enumerate<ChordlessCyclesUno41>(G, false), expected);
+        EXPECT_EQ(enumerate<ChordlessCycles>(G, false), expected);
+        EXPECT_EQ(enumerate<ChordlessCyclesUno3>(G, false), expected);
+        EXPECT_EQ(enumerate<ChordlessCyclesUno4>(G, false), expected);
+        EXPECT_EQ(enumerate<ChordlessCyclesUno>(G).size(), expected.size());
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testBidirectionalSearchMatches) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(20, 0.25).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+    const auto expected = enumerate<ChordlessCycles>(G);
+
+    auto bidirectional = [&](auto algo) {
+        algo.setBidirectional(true);
+        algo.run();
+        return canonical(algo.getChordlessCycles());
+    };
+    for (bool constructive : {true, false}) {
+        const count max = std::numeric_limits<int>::max();
+        EXPECT_EQ(bidirectional(ChordlessCycles(G, order, max, constructive)), expected);
+        EXPECT_EQ(bidirectional(ChordlessCyclesUno3(G, order, max, constructive)), expected);
+        EXPECT_EQ(bidirectional(ChordlessCyclesUno4(G, order, max, constructive)), expected);
+        EXPECT_EQ(bidirectional(ChordlessCyclesUno41(G, order, max, constructive)), expected);
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testUno41ParallelMatchesSequential) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.2).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    for (bool constructive : {true, false}) {
+        ChordlessCyclesUno41 sequential(G, order, std::numeric_limits<int>::max(), constructive);
+        sequential.run();
+
+        ChordlessCyclesUno41 parallel(G, order, std::numeric_limits<int>::max(), constructive);
+        parallel.setParallel(true);
+        parallel.run();
+
+        EXPECT_EQ(canonical(parallel.getChordlessCycles()),
+                  canonical(sequential.getChordlessCycles()));
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testUno41SplitBranchesMatchesSequential) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.2).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    for (bool constructive : {true, false}) {
+        ChordlessCyclesUno41 sequential(G, order, std::numeric_limits<int>::max(), constructive);
+        sequential.run();
+
+        ChordlessCyclesUno41 parallel(G, order, std::numeric_limits<int>::max(), constructive);
+        parallel.setParallel(true, true);
+        parallel.run();
+
+        EXPECT_EQ(canonical(parallel.getChordlessCycles()),
+                  canonical(sequential.getChordlessCycles()));
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testUno41ParallelCallback) {
+    const Graph G = wheel(8);
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    std::vector<std::vector<node>> found;
+    ChordlessCyclesUno41 algo(
+        G,
+        [&](const std::vector<node> &cycle) {
+            found.push_back(cycle);
+            return true;
+        },
+        order);
+    algo.setParallel(true);
+    algo.run();
+
+    EXPECT_EQ(found.size(), 9);
+}
+
+TEST_F(ChordlessCyclesGTest, testCallbackStopsEnumeration) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(20, 0.25).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    count calls = 0;
+    auto stopAfterFive = [&](const std::vector<node> &) { return ++calls < 5; };
+    auto check = [&](ChordlessCycles &&algo) {
+        calls = 0;
+        algo.run();
+        EXPECT_EQ(calls, 5);
+        EXPECT_EQ(algo.numberOfCycles(), 5);
+        EXPECT_TRUE(algo.stoppedEarly());
+    };
+
+    check(ChordlessCycles(G, stopAfterFive, order));
+    check(ChordlessCyclesUno3(G, stopAfterFive, order));
+    check(ChordlessCyclesUno4(G, stopAfterFive, order));
+    check(ChordlessCyclesUno41(G, stopAfterFive, order));
+    for (bool splitBranches : {false, true}) {
+        ChordlessCyclesUno41 parallel(G, stopAfterFive, order);
+        parallel.setParallel(true, splitBranches);
+        check(std::move(parallel));
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testMaxCycles) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(20, 0.25).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    for (bool parallel : {false, true}) {
+        count calls = 0;
+        ChordlessCyclesUno41 withCallback(
+            G,
+            [&](const std::vector<node> &) {
+                ++calls;
+                return true;
+            },
+            order, 7);
+        withCallback.setParallel(parallel, true);
+        withCallback.run();
+        EXPECT_EQ(calls, 7);
+        EXPECT_TRUE(withCallback.stoppedEarly());
+
+        ChordlessCyclesUno41 stored(G, order, 7);
+        stored.setParallel(parallel, true);
+        stored.run();
+        EXPECT_EQ(stored.getChordlessCycles().size(), 7);
+        EXPECT_EQ(stored.numberOfCycles(), 7);
+    }
+
+    ChordlessCyclesUno41 unlimited(G, order);
+    unlimited.run();
+    EXPECT_FALSE(unlimited.stoppedEarly());
+}
+
+TEST_F(ChordlessCyclesGTest, testSIGINTKeepsPartialResults) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(20, 0.25).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    count calls = 0;
+    ChordlessCyclesUno41 algo(
+        G,
+        [&](const std::vector<node> &) {
+            if (++calls == 3)
+                std::raise(SIGINT);
+            return true;
+        },
+        order);
+    algo.run();
+    GlobalState::setReceivedSIGINT(false);
+
+    EXPECT_EQ(calls, 3);
+    EXPECT_TRUE(algo.stoppedEarly());
+}
+
+TEST_F(ChordlessCyclesGTest, testLengthBounds) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.15).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+    const auto all = enumerate<ChordlessCyclesUno41>(G);
+
+    const count unbounded = none;
+    for (auto bounds : std::vector<std::pair<count, count>>{
+             {3, 4}, {3, 6}, {5, 7}, {6, unbounded}, {9, unbounded}, {4, 4}}) {
+        std::vector<std::vector<node>> expected;
+        std::copy_if(all.begin(), all.end(), std::back_inserter(expected),
+                     [&](const std::vector<node> &cycle) {
+                         return cycle.size() >= bounds.first && cycle.size() <= bounds.second;
+                     });
+
+        for (bool constructive : {true, false}) {
+            for (bool parallel : {false, true}) {
+                ChordlessCyclesUno41 algo(G, order, std::numeric_limits<int>::max(),
+                                          constructive);
+                algo.setLengthBounds(bounds.first, bounds.second);
+                algo.setParallel(parallel, true);
+                algo.run();
+                EXPECT_EQ(canonical(algo.getChordlessCycles()), expected);
+            }
+        }
+    }
+
+    ChordlessCyclesUno41 algo(G, order);
+    EXPECT_THROW(algo.setLengthBounds(2, 5), std::runtime_error);
+    EXPECT_THROW(algo.setLengthBounds(6, 5), std::runtime_error);
+}
+
+TEST_F(ChordlessCyclesGTest, testReductionExpandsToAllCycles) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(25, 0.12).generate();
+
+    // Subdivide some edges into long induced paths
+    std::vector<std::pair<node, node>> edges;
+    G.forEdges([&](node u, node v) { edges.emplace_back(u, v); });
+    for (index i = 0; i < edges.size(); i += 2) {
+        const node u = edges[i].first, v = edges[i].second;
+        G.removeEdge(u, v);
+        node previous = u;
+        for (index j = 0; j <= i % 4; ++j) {
+            const node w = G.addNode();
+            G.addEdge(previous, w);
+            previous = w;
+        }
+        G.addEdge(previous, v);
+    }
+    // A cycle and a triangle hanging from single nodes, a pendant path and an isolated cycle
+    node first = G.addNodes(5) - 4;
+    G.addEdge(0, first);
+    for (node u = first; u < first + 4; ++u)
+        G.addEdge(u, u + 1);
+    G.addEdge(first + 4, 0);
+    first = G.addNodes(2) - 1;
+    G.addEdge(1, first);
+    G.addEdge(first, first + 1);
+    G.addEdge(first + 1, 1);
+    first = G.addNodes(3) - 2;
+    G.addEdge(2, first);
+    G.addEdge(first, first + 1);
+    G.addEdge(first + 1, first + 2);
+    first = G.addNodes(6) - 5;
+    for (node u = first; u < first + 5; ++u)
+        G.addEdge(u, u + 1);
+    G.addEdge(first + 5, first);
+
+    const auto expected = enumerate<ChordlessCyclesUno41>(G);
+    for (bool compact : {false, true}) {
+        const auto reduction = reduceForCycles(G, compact);
+        EXPECT_LT(reduction.reducedGraph.numberOfNodes(), G.numberOfNodes());
+        EXPECT_GT(reduction.numInducedPaths, 0);
+        EXPECT_GT(reduction.numCCs, 0);
+        if (compact) {
+            EXPECT_EQ(reduction.reducedGraph.upperNodeIdBound(),
+                      reduction.reducedGraph.numberOfNodes());
+        }
+
+        auto cycles = reduction.cycles;
+        for (const auto &cycle : enumerate<ChordlessCyclesUno41>(reduction.reducedGraph))
+            cycles.push_back(reduction.expand(cycle));
+        EXPECT_EQ(canonical(cycles), expected);
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testBlockDecomposition) {
+    // Random blocks glued at single nodes, with a few bridges and a wheel in between
+    Aux::Random::setSeed(42, false);
+    Graph G = wheel(6);
+    for (count i = 0; i < 12; ++i) {
+        const Graph block = ErdosRenyiGenerator(4 + 3 * (i % 4), 0.5).generate();
+        const node offset = G.upperNodeIdBound();
+        G.addNodes(block.numberOfNodes());
+        block.forEdges([&](node u, node v) { G.addEdge(offset + u, offset + v); });
+        const node attach = Aux::Random::integer(offset - 1);
+        if (i % 3 == 0) {
+            const node bridge = G.addNode();
+            G.addEdge(attach, bridge);
+            G.addEdge(bridge, offset);
+        } else {
+            G.addEdge(attach, offset);
+            G.addEdge(attach, offset + 1);
+        }
+    }
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+    const auto expected = enumerate<ChordlessCyclesUno41>(G);
+
+    for (bool constructive : {true, false}) {
+        for (bool parallel : {false, true}) {
+            ChordlessCyclesUno41 algo(G, order, std::numeric_limits<int>::max(), constructive);
+            algo.setBlockDecomposition(true);
+            algo.setParallel(parallel, true);
+            algo.run();
+            EXPECT_EQ(canonical(algo.getChordlessCycles()), expected);
+
+            std::vector<std::vector<node>> called;
+            ChordlessCyclesUno41 withCallback(
+                G,
+                [&](const std::vector<node> &cycle) {
+                    called.push_back(cycle);
+                    return true;
+                },
+                order, std::numeric_limits<int>::max(), constructive);
+            withCallback.setBlockDecomposition(true);
+            withCallback.setParallel(parallel);
+            withCallback.run();
+            EXPECT_EQ(canonical(called), expected);
+            EXPECT_EQ(withCallback.numberOfCycles(), expected.size());
+        }
+    }
+
+    // A partial node order restricts the search the same way as without blocks
+    std::vector<node> partialOrder(order.begin(), order.begin() + order.size() / 2);
+    std::reverse(partialOrder.begin(), partialOrder.end());
+    for (bool constructive : {true, false}) {
+        ChordlessCyclesUno41 direct(G, partialOrder, std::numeric_limits<int>::max(),
+                                    constructive);
+        direct.run();
+        ChordlessCyclesUno41 blocks(G, partialOrder, std::numeric_limits<int>::max(),
+                                    constructive);
+        blocks.setBlockDecomposition(true);
+        blocks.setParallel(true);
+        blocks.run();
+        EXPECT_EQ(canonical(blocks.getChordlessCycles()),
+                  canonical(direct.getChordlessCycles()));
+    }
+
+    // A single dominating block is searched by all threads together
+    const Graph H = ErdosRenyiGenerator(30, 0.15).generate();
+    std::vector<node> orderH;
+    H.forNodes([&](node u) { orderH.push_back(u); });
+    ChordlessCyclesUno41 dominating(H, orderH);
+    dominating.setBlockDecomposition(true);
+    dominating.setParallel(true, true);
+    dominating.run();
+    EXPECT_EQ(canonical(dominating.getChordlessCycles()), enumerate<ChordlessCyclesUno41>(H));
+
+    ChordlessCyclesUno41 limited(G, order, 10);
+    limited.setBlockDecomposition(true);
+    limited.setParallel(true);
+    limited.run();
+    EXPECT_EQ(limited.getChordlessCycles().size(), 10);
+    EXPECT_TRUE(limited.stoppedEarly());
+}
+
+TEST_F(ChordlessCyclesGTest, testCountingOnly) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.15).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+
+    std::vector<count> expected;
+    const auto all = enumerate<ChordlessCyclesUno41>(G);
+    for (const auto &cycle : all) {
+        if (cycle.size() >= expected.size())
+            expected.resize(cycle.size() + 1, 0);
+        expected[cycle.size()] += 1;
+    }
+
+    auto expectCounts = [&](ChordlessCycles &algo) {
+        algo.setCountingOnly();
+        algo.run();
+        EXPECT_EQ(algo.numberOfCycles(), all.size());
+        EXPECT_EQ(algo.getLengthHistogram(), expected);
+        EXPECT_THROW(algo.getChordlessCycles(), std::runtime_error);
+    };
+
+    ChordlessCyclesUno uno(G, order);
+    expectCounts(uno);
+    ChordlessCyclesUno4 uno4(G, order, std::numeric_limits<int>::max(), false);
+    expectCounts(uno4);
+    for (bool blocks : {false, true}) {
+        ChordlessCyclesUno41 uno41(G, order);
+        uno41.setParallel(true, true);
+        uno41.setBlockDecomposition(blocks);
+        expectCounts(uno41);
+    }
+
+    // The limit holds exactly, also for parallel workers
+    for (bool blocks : {false, true}) {
+        ChordlessCyclesUno41 limited(G, order, 25);
+        limited.setParallel(true, true);
+        limited.setBlockDecomposition(blocks);
+        limited.setCountingOnly();
+        limited.run();
+        const auto &histogram = limited.getLengthHistogram();
+        EXPECT_EQ(limited.numberOfCycles(), 25);
+        EXPECT_EQ(std::accumulate(histogram.begin(), histogram.end(), count{0}), 25);
+        EXPECT_TRUE(limited.stoppedEarly());
+    }
+
+    // Stored cycles are counted as well
+    ChordlessCyclesUno41 stored(G, order);
+    stored.run();
+    EXPECT_EQ(stored.getLengthHistogram(), expected);
+}
+
+TEST_F(ChordlessCyclesGTest, testSearchTreeEstimate) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.15).generate();
+    std::vector<node> order;
+    G.forNodes([&](node u) { order.push_back(u); });
+    const auto cycles = enumerate<ChordlessCyclesUno41>(G);
+    const double all = static_cast<double>(cycles.size());
+
+    for (bool constructive : {true, false}) {
+        ChordlessCyclesUno41 algo(G, order, std::numeric_limits<int>::max(), constructive);
+        const auto estimate = algo.estimateSearchTree(60., 20000);
+        EXPECT_EQ(estimate.probes, 20000);
+        EXPECT_NEAR(estimate.cycles, all, 0.1 * all);
+        EXPECT_NEAR(estimate.cycles, all, 5 * estimate.cyclesStandardError);
+        EXPECT_GE(estimate.treeNodes, estimate.cycles);
+        EXPECT_GT(estimate.bfsNeighborQueries, 0);
+    }
+
+    // Length bounds are respected; the time budget stops the probing
+    ChordlessCyclesUno41 bounded(G, order);
+    bounded.setLengthBounds(3, 4);
+    bounded.setParallel(true);
+    const auto estimate = bounded.estimateSearchTree(0.05);
+    const double numShort = static_cast<double>(
+        std::count_if(cycles.begin(), cycles.end(),
+                      [](const std::vector<node> &cycle) { return cycle.size() <= 4; }));
+    EXPECT_GT(estimate.probes, 0);
+    EXPECT_NEAR(estimate.cycles, numShort, 0.2 * numShort);
+}
+
+TEST_F(ChordlessCyclesGTest, testSelectNodeOrder) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(30, 0.15).generate();
+    const auto expected = enumerate<ChordlessCyclesUno41>(G);
+
+    for (bool constructive : {true, false}) {
+        const auto choice = selectNodeOrder(G, constructive, 0.02);
+        ASSERT_EQ(choice.candidates.size(), 6);
+        ASSERT_LT(choice.chosen, choice.candidates.size());
+        for (const auto &candidate : choice.candidates) {
+            EXPECT_GT(candidate.estimate.probes, 0);
+            EXPECT_LE(choice.candidates[choice.chosen].cost(), candidate.cost());
+        }
+
+        auto sorted = choice.order;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<node> nodes;
+        G.forNodes([&](node u) { nodes.push_back(u); });
+        EXPECT_EQ(sorted, nodes);
+
+        ChordlessCyclesUno41 algo(G, choice.order, std::numeric_limits<int>::max(),
+                                  constructive);
+        algo.run();
+        EXPECT_EQ(canonical(algo.getChordlessCycles()), expected);
+    }
+}
+
+TEST_F(ChordlessCyclesGTest, testDegeneracyOrder) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(2000, 0.01).generate();
+    Partition p(G.upperNodeIdBound());
+    p.setUpperBound(3);
+    G.forNodes([&](node u) { p.addToSubset(Aux::Random::integer(2), u); });
+
+    // Most neighbors of a node after it in the order, counting edges within subsets if given
+    auto maxLaterNeighbors = [&](const std::vector<node> &order, const Partition *subsets) {
+        std::vector<index> position(G.upperNodeIdBound(), none);
+        for (index i = 0; i < order.size(); ++i)
+            position[order[i]] = i;
+        count result = 0;
+        G.forNodes([&](node u) {
+            count later = 0;
+            G.forNeighborsOf(u, [&](node v) {
+                if (position[v] > position[u] && (!subsets || subsets->inSameSubset(u, v)))
+                    ++later;
+            });
+            result = std::max(result, later);
+        });
+        return result;
+    };
+    auto expectPermutation = [&](std::vector<node> order) {
+        std::sort(order.begin(), order.end());
+        std::vector<node> nodes;
+        G.forNodes([&](node u) { nodes.push_back(u); });
+        EXPECT_EQ(order, nodes);
+    };
+
+    for (bool deleteNodes : {false, true}) {
+        if (deleteNodes) {
+            // Node ids with gaps run the sequential variant
+            for (node u = 0; u < G.upperNodeIdBound(); u += 10)
+                G.removeNode(u);
+        }
+
+        const auto order = degeneracyOrderedNodes(G);
+        expectPermutation(order);
+        EXPECT_EQ(maxLaterNeighbors(order, nullptr),
+                  maxLaterNeighbors(smallestFirstOrderedNodes(G), nullptr));
+
+        const auto restricted = degeneracyOrderedNodes(G, p);
+        expectPermutation(restricted);
+        EXPECT_EQ(maxLaterNeighbors(restricted, &p),
+                  maxLaterNeighbors(fastSmallestFirstOrderedNodes(G, p), &p));
+    }
+}
+
+} // namespace NetworKit
@@ -0,0 +1,82 @@
+#include <limits>
+#include <stdexcept>
+
+#include <networkit/graph/CSRGraph.hpp>
+
+namespace NetworKit {
+
+namespace {
+
+// Prefix sums of the degrees, computed in parallel
+template <typename Degree>
+std::vector<index> computeOffsets(const Graph &G, Degree degree) {
+    const count z = G.upperNodeIdBound();
+    std::vector<index> offsets(z + 1, 0);
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(z); ++u)
+        if (G.hasNode(u))
+            offsets[u + 1] = degree(u);
+
+    for (index u = 0; u < z; ++u)
+        offsets[u + 1] += offsets[u];
+    return offsets;
+}
+
+template <typename Id, typename ForNeighbors>
+void fillArrays(const Graph &G, const std::vector<index> &offsets, std::vector<Id> &neighbors,
+                std::vector<edgeweight> &weights, std::vector<Id> &edgeIds,
+                ForNeighbors forNeighbors) {
+    neighbors.resize(offsets.back());
+    if (G.isWeighted())
+        weights.resize(offsets.back());
+    if (G.hasEdgeIds())
+        edgeIds.resize(offsets.back());
+
+    G.parallelForNodes([&](node u) {
+        index i = offsets[u];
+        forNeighbors(u, [&](node, node v, edgeweight ew, edgeid id) {
+            neighbors[i] = static_cast<Id>(v);
+            if (!weights.empty())
+                weights[i] = ew;
+            if (!edgeIds.empty())
+                edgeIds[i] = static_cast<Id>(id);
+            ++i;
+        });
+    });
+}
+
+} // namespace
+
+template <typename Id>
+CSRGraphT<Id>::CSRGraphT(const Graph &G)
+    : n(G.numberOfNodes()), m(G.numberOfEdges()), z(G.upperNodeIdBound()),
+      directed(G.isDirected()), exists(z, false) {
+    if (z > std::numeric_limits<Id>::max()
+        || (G.hasEdgeIds() && G.upperEdgeIdBound() > std::numeric_limits<Id>::max()))
+        throw std::runtime_error("Error: the ids of the graph do not fit the id type");
+
+    G.forNodes([&](node u) { exists[u] = true; });
+
+    outOffsets = computeOffsets(G, [&](node u) { return G.degree(u); });
+    fillArrays(G, outOffsets, outNeighbors, outWeights, outEdgeIds,
+               [&](node u, auto handle) { G.forNeighborsOf(u, handle); });
+
+    if (directed) {
+        inOffsets = computeOffsets(G, [&](node u) { return G.degreeIn(u); });
+        fillArrays(G, inOffsets, inNeighbors, inWeights, inEdgeIds,
+                   [&](node u, auto handle) { G.forInNeighborsOf(u, handle); });
+    }
+}
+
+template <typename Id>
+count CSRGraphT<Id>::memoryUsage() const {
+    auto bytes = [](const auto &v) { return v.size() * sizeof(v[0]); };
+    return exists.size() / 8 + bytes(outOffsets) + bytes(outNeighbors) + bytes(outWeights)
+           + bytes(outEdgeIds) + bytes(inOffsets) + bytes(inNeighbors) + bytes(inWeights)
+           + bytes(inEdgeIds);
+}
+
+template class CSRGraphT<node>;
+template class CSRGraphT<uint32_t>;
+
+} // namespace NetworKit
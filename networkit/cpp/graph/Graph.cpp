@@ -7,12 +7,14 @@
  *              Marvin Ritter <marvin.ritter@gmail.com>
  */
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <random>
 #include <sstream>
 
 #include <networkit/auxiliary/Log.hpp>
+#include <networkit/auxiliary/Parallel.hpp>
 #include <networkit/graph/Graph.hpp>
 #include <networkit/graph/GraphTools.hpp>
 
@@ -198,10 +200,25 @@ void Graph::preallocateDirectedInEdges(node u, size_t inSize) {
 }
 /** PRIVATE HELPERS **/
 
+namespace {
+
+// Index of the first occurrence of v in the sorted adjacency array, or none
+index indexInSortedArray(const std::vector<node> &adjacency, node v) {
+    const auto it = std::lower_bound(adjacency.begin(), adjacency.end(), v);
+    if (it == adjacency.end() || *it != v)
+        return none;
+    return static_cast<index>(it - adjacency.begin());
+}
+
+} // namespace
+
 index Graph::indexInInEdgeArray(node v, node u) const {
     if (!directed) {
         return indexInOutEdgeArray(v, u);
     }
+    if (sortedAdjacency) {
+        return indexInSortedArray(inEdges[v], u);
+    }
     for (index i = 0; i < inEdges[v].size(); i++) {
         node x = inEdges[v][i];
         if (x == u) {
@@ -212,6 +229,9 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 }
 
 index Graph::indexInOutEdgeArray(node u, node v) const {
+    if (sortedAdjacency) {
+        return indexInSortedArray(outEdges[u], v);
+    }
     for (index i = 0; i < outEdges[u].size(); i++) {
         node x = outEdges[u][i];
         if (x == v) {
@@ -437,6 +457,12 @@ void Graph::sortEdges() {
     }
 }
 
+void Graph::setSortedAdjacency(bool sorted) {
+    if (sorted && !sortedAdjacency)
+        sortEdges();
+    sortedAdjacency = sorted;
+}
+
 edgeweight Graph::computeWeightedDegree(node u, bool inDegree, bool countSelfLoopsTwice) const {
     if (weighted) {
         edgeweight sum = 0.0;
@@ -528,17 +554,99 @@ void Graph::removeNode(node v) {
     assert(v < z);
     assert(exists[v]);
 
-    // Remove all outgoing and ingoing edges
-    while (!outEdges[v].empty())
-        removeEdge(v, outEdges[v].front());
-    if (isDirected())
-        while (!inEdges[v].empty())
-            removeEdge(inEdges[v].front(), v);
+    // Removes v from the adjacency arrays of its neighbors in one pass each, sequentially
+    // as single nodes are mostly removed in loops
+    auto isV = [v](node u) { return u == v; };
+    count removedSelfLoops = 0;
+    for (node u : outEdges[v]) {
+        if (u == v)
+            ++removedSelfLoops;
+        else
+            removeAdjacentEdges(u, isV, directed);
+    }
+    if (directed) {
+        for (node u : inEdges[v])
+            if (u != v)
+                removeAdjacentEdges(u, isV);
+    }
 
+    m -= outEdges[v].size() + (directed ? inEdges[v].size() - removedSelfLoops : 0);
+    storedNumberOfSelfLoops -= removedSelfLoops;
+    clearAdjacentEdges(v);
     exists[v] = false;
     n--;
 }
 
+void Graph::clearAdjacentEdges(node u) {
+    outEdges[u].clear();
+    if (weighted)
+        outEdgeWeights[u].clear();
+    if (edgesIndexed)
+        outEdgeIds[u].clear();
+    if (directed) {
+        inEdges[u].clear();
+        if (weighted)
+            inEdgeWeights[u].clear();
+        if (edgesIndexed)
+            inEdgeIds[u].clear();
+    }
+}
+
+void Graph::removeNodesImpl(std::vector<node> nodes) {
+    Aux::Parallel::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    auto isRemoved = [&](node v) { return std::binary_search(nodes.begin(), nodes.end(), v); };
+
+    // Count the removed edges and collect the remaining nodes adjacent to removed ones
+    count removedEdges = 0;
+    count removedSelfLoops = 0;
+    count edgesWithin = 0;
+    std::vector<node> neighbors;
+    for (node u : nodes) {
+        assert(hasNode(u));
+        for (node v : outEdges[u]) {
+            if (v == u) {
+                ++removedSelfLoops;
+            } else if (isRemoved(v)) {
+                ++edgesWithin;
+            } else {
+                ++removedEdges;
+                neighbors.push_back(v);
+            }
+        }
+        if (directed) {
+            for (node v : inEdges[u]) {
+                if (!isRemoved(v)) {
+                    ++removedEdges;
+                    neighbors.push_back(v);
+                }
+            }
+        }
+    }
+    // Undirected edges between removed nodes are stored at both end points
+    removedEdges += directed ? edgesWithin : edgesWithin / 2;
+
+    Aux::Parallel::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+
+    // Small batches are not worth the fork and join
+#pragma omp parallel for schedule(dynamic, 16) if (neighbors.size() > 1024)
+    for (omp_index i = 0; i < static_cast<omp_index>(neighbors.size()); ++i) {
+        removeAdjacentEdges(neighbors[i], isRemoved);
+        if (directed)
+            removeAdjacentEdges(neighbors[i], isRemoved, true);
+    }
+
+    for (node u : nodes) {
+        clearAdjacentEdges(u);
+        exists[u] = false;
+    }
+
+    n -= nodes.size();
+    m -= removedEdges + removedSelfLoops;
+    storedNumberOfSelfLoops -= removedSelfLoops;
+}
+
 void Graph::restoreNode(node v) {
     assert(v < z);
     assert(!exists[v]);
@@ -567,40 +675,43 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 
     // increase number of edges
     ++m;
-    outEdges[u].push_back(v);
+    const index vi = insertionIndex(outEdges[u], v);
+    insertAt(u, vi, v, outEdges);
 
     // if edges indexed, give new id
     if (edgesIndexed) {
         edgeid id = omega++;
-        outEdgeIds[u].push_back(id);
+        insertAt(u, vi, id, outEdgeIds);
     }
 
     if (directed) {
-        inEdges[v].push_back(u);
+        const index ui = insertionIndex(inEdges[v], u);
+        insertAt(v, ui, u, inEdges);
 
         if (edgesIndexed) {
-            inEdgeIds[v].push_back(omega - 1);
+            insertAt(v, ui, omega - 1, inEdgeIds);
         }
 
         if (weighted) {
-            inEdgeWeights[v].push_back(ew);
-            outEdgeWeights[u].push_back(ew);
+            insertAt(v, ui, ew, inEdgeWeights);
+            insertAt(u, vi, ew, outEdgeWeights);
         }
 
     } else if (u == v) { // self-loop case
         if (weighted) {
-            outEdgeWeights[u].push_back(ew);
+            insertAt(u, vi, ew, outEdgeWeights);
         }
     } else { // undirected, no self-loop
-        outEdges[v].push_back(u);
+        const index ui = insertionIndex(outEdges[v], u);
+        insertAt(v, ui, u, outEdges);
 
         if (weighted) {
-            outEdgeWeights[u].push_back(ew);
-            outEdgeWeights[v].push_back(ew);
+            insertAt(u, vi, ew, outEdgeWeights);
+            insertAt(v, ui, ew, outEdgeWeights);
         }
 
         if (edgesIndexed) {
-            outEdgeIds[v].push_back(omega - 1);
+            insertAt(v, ui, omega - 1, outEdgeIds);
         }
     }
 
@@ -614,14 +725,15 @@ void Graph::addPartialEdge(Unsafe, node u, node v, edgeweight ew, uint64_t index
     assert(v < z);
     assert(exists[v]);
 
-    outEdges[u].push_back(v);
+    const auto vi = insertionIndex(outEdges[u], v);
+    insertAt(u, vi, v, outEdges);
 
     // if edges indexed, give new id
     if (edgesIndexed) {
-        outEdgeIds[u].push_back(index);
+        insertAt(u, vi, index, outEdgeIds);
     }
     if (weighted) {
-        outEdgeWeights[u].push_back(ew);
+        insertAt(u, vi, ew, outEdgeWeights);
     }
 }
 void Graph::addPartialOutEdge(Unsafe, node u, node v, edgeweight ew, uint64_t index) {
@@ -630,14 +742,15 @@ void Graph::addPartialOutEdge(Unsafe, node u, node v, edgeweight ew, uint64_t in
     assert(v < z);
     assert(exists[v]);
 
-    outEdges[u].push_back(v);
+    const auto vi = insertionIndex(outEdges[u], v);
+    insertAt(u, vi, v, outEdges);
 
     // if edges indexed, give new id
     if (edgesIndexed) {
-        outEdgeIds[u].push_back(index);
+        insertAt(u, vi, index, outEdgeIds);
     }
     if (weighted) {
-        outEdgeWeights[u].push_back(ew);
+        insertAt(u, vi, ew, outEdgeWeights);
     }
 }
 void Graph::addPartialInEdge(Unsafe, node u, node v, edgeweight ew, uint64_t index) {
@@ -646,13 +759,14 @@ void Graph::addPartialInEdge(Unsafe, node u, node v, edgeweight ew, uint64_t ind
     assert(v < z);
     assert(exists[v]);
 
-    inEdges[u].push_back(v);
+    const auto vi = insertionIndex(inEdges[u], v);
+    insertAt(u, vi, v, inEdges);
 
     if (edgesIndexed) {
-        inEdgeIds[u].push_back(index);
+        insertAt(u, vi, index, inEdgeIds);
     }
     if (weighted) {
-        inEdgeWeights[u].push_back(ew);
+        insertAt(u, vi, ew, inEdgeWeights);
     }
 }
 
@@ -662,6 +776,27 @@ void erase(node u, index idx, std::vector<std::vector<T>> &vec) {
     vec[u].pop_back();
 }
 
+template <typename T>
+void Graph::insertAt(node u, index idx, const T &value, std::vector<std::vector<T>> &vec) {
+    vec[u].insert(vec[u].begin() + idx, value);
+}
+
+template <typename T>
+void Graph::eraseAt(node u, index idx, std::vector<std::vector<T>> &vec) {
+    if (sortedAdjacency)
+        vec[u].erase(vec[u].begin() + idx);
+    else
+        erase(u, idx, vec);
+}
+
+index Graph::insertionIndex(const std::vector<node> &adjacency, node v) const {
+    if (!sortedAdjacency)
+        return adjacency.size();
+    // Behind equal neighbors, so that multi-edges keep their insertion order
+    return static_cast<index>(std::upper_bound(adjacency.begin(), adjacency.end(), v)
+                              - adjacency.begin());
+}
+
 void Graph::removeEdge(node u, node v) {
     assert(u < z);
     assert(exists[u]);
@@ -682,36 +817,133 @@ void Graph::removeEdge(node u, node v) {
     if (isLoop)
         storedNumberOfSelfLoops--;
 
-    erase<node>(u, vi, outEdges);
+    eraseAt<node>(u, vi, outEdges);
     if (weighted) {
-        erase<edgeweight>(u, vi, outEdgeWeights);
+        eraseAt<edgeweight>(u, vi, outEdgeWeights);
     }
     if (edgesIndexed) {
-        erase<edgeid>(u, vi, outEdgeIds);
+        eraseAt<edgeid>(u, vi, outEdgeIds);
     }
 
     if (directed) {
         assert(ui != none);
 
-        erase<node>(v, ui, inEdges);
+        eraseAt<node>(v, ui, inEdges);
         if (weighted) {
-            erase<edgeweight>(v, ui, inEdgeWeights);
+            eraseAt<edgeweight>(v, ui, inEdgeWeights);
         }
         if (edgesIndexed) {
-            erase<edgeid>(v, ui, inEdgeIds);
+            eraseAt<edgeid>(v, ui, inEdgeIds);
         }
     } else if (!isLoop) {
         // undirected, not self-loop
-        erase<node>(v, ui, outEdges);
+        eraseAt<node>(v, ui, outEdges);
         if (weighted) {
-            erase<edgeweight>(v, ui, outEdgeWeights);
+            eraseAt<edgeweight>(v, ui, outEdgeWeights);
         }
         if (edgesIndexed) {
-            erase<edgeid>(v, ui, outEdgeIds);
+            eraseAt<edgeid>(v, ui, outEdgeIds);
         }
     }
 }
 
+namespace {
+
+// Half edges (owner, target) grouped by the node whose adjacency array holds them
+struct HalfEdgeGroups {
+    std::vector<node> owners;
+    std::vector<index> starts;
+    std::vector<node> targets;
+
+    explicit HalfEdgeGroups(std::vector<std::pair<node, node>> halves) {
+        Aux::Parallel::sort(halves.begin(), halves.end());
+        targets.reserve(halves.size());
+        for (index i = 0; i < halves.size(); ++i) {
+            if (i == 0 || halves[i].first != halves[i - 1].first) {
+                owners.push_back(halves[i].first);
+                starts.push_back(i);
+            }
+            targets.push_back(halves[i].second);
+        }
+        starts.push_back(halves.size());
+    }
+
+    count size() const { return owners.size(); }
+};
+
+} // namespace
+
+count Graph::removeListedNeighbors(node u, const node *first, const node *last, bool edgesIn,
+                                   bool dryRun) {
+    // Every listed neighbor matches one entry, so that multi-edges are removed one at a time
+    std::vector<bool> matched(last - first, false);
+    auto isListed = [&](node v) {
+        for (auto it = std::lower_bound(first, last, v); it != last && *it == v; ++it) {
+            if (!matched[it - first]) {
+                matched[it - first] = true;
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (dryRun) {
+        const auto &adjacency = edgesIn ? inEdges[u] : outEdges[u];
+        return std::count_if(adjacency.begin(), adjacency.end(), isListed);
+    }
+    removeAdjacentEdges(u, isListed, edgesIn);
+    return std::count(matched.begin(), matched.end(), true);
+}
+
+void Graph::removeEdgesImpl(std::vector<std::pair<node, node>> edges) {
+    std::vector<std::pair<node, node>> outHalves, inHalves;
+    outHalves.reserve(directed ? edges.size() : 2 * edges.size());
+    if (directed)
+        inHalves.reserve(edges.size());
+
+    count removedSelfLoops = 0;
+    for (const auto &e : edges) {
+        const node u = e.first, v = e.second;
+        if (!hasNode(u) || !hasNode(v)) {
+            std::stringstream strm;
+            strm << "edge (" << u << "," << v << ") does not exist";
+            throw std::runtime_error(strm.str());
+        }
+        outHalves.emplace_back(u, v);
+        if (directed)
+            inHalves.emplace_back(v, u);
+        else if (u != v)
+            outHalves.emplace_back(v, u);
+        removedSelfLoops += (u == v);
+    }
+
+    const HalfEdgeGroups outGroups(std::move(outHalves));
+    const HalfEdgeGroups inGroups(std::move(inHalves));
+
+    auto forGroups = [&](const HalfEdgeGroups &groups, bool edgesIn, bool dryRun) {
+        bool complete = true;
+#pragma omp parallel for schedule(dynamic) reduction(&& : complete) if (groups.size() > 1024)
+        for (omp_index i = 0; i < static_cast<omp_index>(groups.size()); ++i) {
+            const node *first = groups.targets.data() + groups.starts[i];
+            const node *last = groups.targets.data() + groups.starts[i + 1];
+            const count found =
+                removeListedNeighbors(groups.owners[i], first, last, edgesIn, dryRun);
+            complete = complete && found == static_cast<count>(last - first);
+        }
+        return complete;
+    };
+
+    // Check all edges before touching any adjacency array
+    if (!forGroups(outGroups, false, true) || !forGroups(inGroups, true, true))
+        throw std::runtime_error("an edge to remove does not exist");
+
+    forGroups(outGroups, false, false);
+    forGroups(inGroups, true, false);
+
+    m -= edges.size();
+    storedNumberOfSelfLoops -= removedSelfLoops;
+}
+
 void Graph::removeAllEdges() {
     parallelForNodes([&](const node u) {
         removePartialOutEdges(unsafe, u);
@@ -774,6 +1006,9 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
         throw std::runtime_error("The second edge does not exist");
     index t2s2 = indexInInEdgeArray(t2, s2);
 
+    // Swapped targets break the order of the adjacency arrays
+    sortedAdjacency = false;
+
     std::swap(outEdges[s1][s1t1], outEdges[s2][s2t2]);
 
     if (directed) {
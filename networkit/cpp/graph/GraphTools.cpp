@@ -489,6 +489,48 @@ Graph restoreGraph(const std::vector<node> &invertedIdMap, const Graph &G) {
     return Goriginal;
 }
 
+Graph getPermutedGraph(const Graph &G, const std::vector<node> &permutation) {
+    if (permutation.size() != G.upperNodeIdBound())
+        throw std::runtime_error("Error: the permutation does not match the node ids");
+
+    const count n = G.numberOfNodes();
+    Graph Gnew(n, G.isWeighted(), G.isDirected());
+    if (G.hasEdgeIds())
+        Gnew.indexEdges();
+
+#pragma omp parallel for
+    for (omp_index u = 0; u < static_cast<omp_index>(G.upperNodeIdBound()); ++u) {
+        if (!G.hasNode(u))
+            continue;
+        const node pu = permutation[u];
+        assert(pu < n);
+
+        if (G.isDirected()) {
+            Gnew.preallocateDirected(pu, G.degreeOut(u), G.degreeIn(u));
+            G.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) {
+                Gnew.addPartialOutEdge(unsafe, pu, permutation[v], w, id);
+            });
+            G.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) {
+                Gnew.addPartialInEdge(unsafe, pu, permutation[v], w, id);
+            });
+        } else {
+            Gnew.preallocateUndirected(pu, G.degree(u));
+            G.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) {
+                Gnew.addPartialEdge(unsafe, pu, permutation[v], w, id);
+            });
+        }
+    }
+
+    Gnew.setEdgeCount(unsafe, G.numberOfEdges());
+    Gnew.setNumberOfSelfLoops(unsafe, G.numberOfSelfLoops());
+    Gnew.setUpperEdgeIdBound(unsafe, G.upperEdgeIdBound());
+    if (G.hasSortedAdjacency())
+        Gnew.setSortedAdjacency();
+    assert(Gnew.checkConsistency());
+
+    return Gnew;
+}
+
 void sortEdgesByWeight(Graph &G, bool decreasing) {
     if (decreasing)
         G.sortEdges([](auto e1, auto e2) {
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include <networkit/auxiliary/Parallel.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/NodeRelabeling.hpp>
+
+namespace NetworKit {
+
+NodeRelabeling::NodeRelabeling(const Graph &G, Order order) : G(&G), order(order) {
+    if (order == Order::COMMUNITY)
+        throw std::runtime_error("Error: relabeling by community needs the communities");
+}
+
+NodeRelabeling::NodeRelabeling(const Graph &G, const Partition &communities)
+    : G(&G), order(Order::COMMUNITY), communities(&communities) {
+    if (communities.numberOfElements() < G.upperNodeIdBound())
+        throw std::runtime_error("Error: the partition does not cover all nodes of the graph");
+}
+
+void NodeRelabeling::run() {
+    switch (order) {
+    case Order::BFS:
+        inversePermutation = bfsOrder(false);
+        break;
+    case Order::REVERSE_CUTHILL_MCKEE:
+        inversePermutation = bfsOrder(true);
+        break;
+    case Order::DEGREE:
+        inversePermutation = degreeOrder();
+        break;
+    case Order::DEGENERACY:
+        inversePermutation = degeneracyOrder();
+        break;
+    case Order::COMMUNITY:
+        inversePermutation = communityOrder();
+        break;
+    }
+    assert(inversePermutation.size() == G->numberOfNodes());
+
+    permutation.assign(G->upperNodeIdBound(), none);
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(inversePermutation.size()); ++i)
+        permutation[inversePermutation[i]] = static_cast<node>(i);
+
+    hasRun = true;
+}
+
+Graph NodeRelabeling::getRelabeledGraph() const {
+    assureFinished();
+    return GraphTools::getPermutedGraph(*G, permutation);
+}
+
+std::vector<node> NodeRelabeling::bfsOrder(bool cuthillMcKee) const {
+    std::vector<count> degrees;
+    std::vector<node> starts;
+    starts.reserve(G->numberOfNodes());
+    G->forNodes([&](node u) { starts.push_back(u); });
+
+    auto byDegree = [&](node u, node v) { return degrees[u] < degrees[v]; };
+    if (cuthillMcKee) {
+        degrees.resize(G->upperNodeIdBound());
+        G->parallelForNodes([&](node u) { degrees[u] = undirectedDegree(u); });
+        // Start each component from one of its nodes of minimum degree
+        std::stable_sort(starts.begin(), starts.end(), byDegree);
+    }
+
+    std::vector<bool> visited(G->upperNodeIdBound(), false);
+    std::vector<node> result;
+    result.reserve(G->numberOfNodes());
+    for (node s : starts) {
+        if (visited[s])
+            continue;
+        visited[s] = true;
+        result.push_back(s);
+
+        // The result is the queue of the search
+        for (index head = result.size() - 1; head < result.size(); ++head) {
+            const index first = result.size();
+            forUndirectedNeighborsOf(result[head], [&](node v) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    result.push_back(v);
+                }
+            });
+            if (cuthillMcKee)
+                std::stable_sort(result.begin() + first, result.end(), byDegree);
+        }
+    }
+
+    if (cuthillMcKee)
+        std::reverse(result.begin(), result.end());
+    return result;
+}
+
+std::vector<node> NodeRelabeling::degreeOrder() const {
+    std::vector<count> degrees(G->upperNodeIdBound());
+    std::vector<node> result;
+    result.reserve(G->numberOfNodes());
+    G->forNodes([&](node u) {
+        degrees[u] = undirectedDegree(u);
+        result.push_back(u);
+    });
+
+    Aux::Parallel::sort(result.begin(), result.end(), [&](node u, node v) {
+        return degrees[u] > degrees[v] || (degrees[u] == degrees[v] && u < v);
+    });
+    return result;
+}
+
+std::vector<node> NodeRelabeling::degeneracyOrder() const {
+    // Bucket-based peeling of Batagelj and Zaversnik: the result holds the nodes sorted by
+    // their current degree, binStart[d] being the first position with degree d
+    std::vector<count> degrees(G->upperNodeIdBound(), 0);
+    count maxDegree = 0;
+    G->forNodes([&](node u) {
+        degrees[u] = undirectedDegree(u);
+        maxDegree = std::max(maxDegree, degrees[u]);
+    });
+
+    std::vector<index> binStart(maxDegree + 2, 0);
+    G->forNodes([&](node u) { ++binStart[degrees[u] + 1]; });
+    std::partial_sum(binStart.begin(), binStart.end(), binStart.begin());
+
+    std::vector<node> result(G->numberOfNodes());
+    std::vector<index> position(G->upperNodeIdBound());
+    {
+        auto next = binStart;
+        G->forNodes([&](node u) {
+            position[u] = next[degrees[u]]++;
+            result[position[u]] = u;
+        });
+    }
+
+    for (index i = 0; i < result.size(); ++i) {
+        const node u = result[i];
+        forUndirectedNeighborsOf(u, [&](node v) {
+            if (degrees[v] <= degrees[u])
+                return;
+            // Move v to the front of its bin, which then shrinks by one
+            const index front = binStart[degrees[v]];
+            const node w = result[front];
+            std::swap(result[front], result[position[v]]);
+            position[w] = position[v];
+            position[v] = front;
+            ++binStart[degrees[v]];
+            --degrees[v];
+        });
+    }
+    return result;
+}
+
+std::vector<node> NodeRelabeling::communityOrder() const {
+    const auto bfs = bfsOrder(false);
+    std::vector<index> rank(G->upperNodeIdBound());
+#pragma omp parallel for
+    for (omp_index i = 0; i < static_cast<omp_index>(bfs.size()); ++i)
+        rank[bfs[i]] = static_cast<index>(i);
+
+    // Communities are ordered by the first of their nodes in breadth-first search order
+    const Partition &zeta = *communities;
+    std::vector<index> communityRank(zeta.upperBound(), none);
+    for (node u : bfs)
+        if (zeta[u] != none && communityRank[zeta[u]] == none)
+            communityRank[zeta[u]] = rank[u];
+
+    auto key = [&](node u) { return zeta[u] == none ? rank[u] : communityRank[zeta[u]]; };
+    auto result = bfs;
+    Aux::Parallel::sort(result.begin(), result.end(), [&](node u, node v) {
+        return key(u) < key(v) || (key(u) == key(v) && rank[u] < rank[v]);
+    });
+    return result;
+}
+
+} // namespace NetworKit
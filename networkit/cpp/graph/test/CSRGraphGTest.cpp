@@ -0,0 +1,116 @@
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/BFS.hpp>
+#include <networkit/graph/CSRGraph.hpp>
+#include <networkit/graph/Graph.hpp>
+
+namespace NetworKit {
+
+class CSRGraphGTest : public testing::TestWithParam<std::tuple<bool, bool>> {
+protected:
+    bool isWeighted() const { return std::get<0>(GetParam()); }
+    bool isDirected() const { return std::get<1>(GetParam()); }
+
+    Graph generateGraph() const {
+        Aux::Random::setSeed(42, false);
+        Graph G(ErdosRenyiGenerator(200, 0.05, isDirected()).generate(), isWeighted(),
+                isDirected());
+        if (isWeighted())
+            G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+        G.removeNode(7);
+        G.removeNode(100);
+        G.indexEdges();
+        return G;
+    }
+
+    template <typename CSR>
+    void checkSnapshot(const Graph &G, const CSR &csr) const;
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, CSRGraphGTest,
+                         testing::Values(std::make_tuple(false, false),
+                                         std::make_tuple(true, false),
+                                         std::make_tuple(false, true),
+                                         std::make_tuple(true, true)));
+
+template <typename CSR>
+void CSRGraphGTest::checkSnapshot(const Graph &G, const CSR &csr) const {
+    EXPECT_EQ(csr.numberOfNodes(), G.numberOfNodes());
+    EXPECT_EQ(csr.numberOfEdges(), G.numberOfEdges());
+    EXPECT_EQ(csr.upperNodeIdBound(), G.upperNodeIdBound());
+    EXPECT_EQ(csr.isDirected(), G.isDirected());
+    EXPECT_EQ(csr.isWeighted(), G.isWeighted());
+    EXPECT_TRUE(csr.hasEdgeIds());
+
+    for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+        ASSERT_EQ(csr.hasNode(u), G.hasNode(u));
+        ASSERT_EQ(csr.degree(u), G.hasNode(u) ? G.degree(u) : 0);
+        ASSERT_EQ(csr.degreeIn(u), G.hasNode(u) ? G.degreeIn(u) : 0);
+    }
+
+    csr.forNodes([&](node u) {
+        std::vector<std::tuple<node, edgeweight, edgeid>> expected, actual;
+        G.forNeighborsOf(u, [&](node, node v, edgeweight ew, edgeid id) {
+            expected.emplace_back(v, ew, id);
+        });
+        csr.forNeighborsOf(u, [&](node, node v, edgeweight ew, edgeid id) {
+            actual.emplace_back(v, ew, id);
+        });
+        EXPECT_EQ(actual, expected);
+
+        std::vector<node> range;
+        for (node v : csr.neighborRange(u))
+            range.push_back(v);
+        std::vector<node> single;
+        csr.forNeighborsOf(u, [&](node v) { single.push_back(v); });
+        EXPECT_EQ(range, single);
+        EXPECT_EQ(range.size(), expected.size());
+
+        std::vector<node> expectedIn, actualIn;
+        G.forInNeighborsOf(u, [&](node v) { expectedIn.push_back(v); });
+        csr.forInNeighborsOf(u, [&](node v) { actualIn.push_back(v); });
+        EXPECT_EQ(actualIn, expectedIn);
+    });
+}
+
+TEST_P(CSRGraphGTest, testSnapshot) {
+    const Graph G = generateGraph();
+    checkSnapshot(G, CSRGraph(G));
+    checkSnapshot(G, CSRGraph32(G));
+}
+
+TEST_P(CSRGraphGTest, testParallelForNodes) {
+    const Graph G = generateGraph();
+    const CSRGraph32 csr(G);
+
+    std::vector<count> degrees(G.upperNodeIdBound(), none);
+    csr.parallelForNodes([&](node u) { degrees[u] = csr.degree(u); });
+    for (node u = 0; u < G.upperNodeIdBound(); ++u)
+        EXPECT_EQ(degrees[u], G.hasNode(u) ? G.degree(u) : none);
+}
+
+TEST_P(CSRGraphGTest, testBFS) {
+    const Graph G = generateGraph();
+    const CSRGraph32 csr(G);
+
+    std::vector<std::pair<node, count>> expected, actual;
+    Traversal::BFSfrom(G, 0, [&](node u, count dist) { expected.emplace_back(u, dist); });
+    Traversal::BFSfrom(csr, 0, [&](node u, count dist) { actual.emplace_back(u, dist); });
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_P(CSRGraphGTest, testMemoryUsage) {
+    const Graph G = generateGraph();
+    const CSRGraph csr(G);
+    const CSRGraph32 csr32(G);
+
+    EXPECT_LT(csr32.memoryUsage(), csr.memoryUsage());
+    EXPECT_GE(csr.memoryUsage(), G.numberOfEdges() * sizeof(node));
+}
+
+} // namespace NetworKit
@@ -2242,6 +2242,127 @@ TEST_P(GraphGTest, testSortEdges) {
     }
 }
 
+TEST_P(GraphGTest, testSortedAdjacency) {
+    constexpr node n = 60;
+
+    Aux::Random::setSeed(42, false);
+    Graph reference = createGraph(n, 4 * n);
+    reference.indexEdges();
+    Graph G = reference;
+    G.setSortedAdjacency();
+    EXPECT_TRUE(G.hasSortedAdjacency());
+
+    auto checkSorted = [&]() {
+        G.forNodes([&](node u) {
+            std::vector<node> out, in;
+            G.forNeighborsOf(u, [&](node v) { out.push_back(v); });
+            G.forInNeighborsOf(u, [&](node v) { in.push_back(v); });
+            EXPECT_TRUE(std::is_sorted(out.begin(), out.end()));
+            EXPECT_TRUE(std::is_sorted(in.begin(), in.end()));
+        });
+    };
+
+    // Apply the same insertions and removals, including self-loops, to both graphs
+    for (index i = 0; i < 500; ++i) {
+        const node u = Aux::Random::index(n);
+        const node v = Aux::Random::index(n);
+        if (reference.hasEdge(u, v)) {
+            reference.removeEdge(u, v);
+            G.removeEdge(u, v);
+        } else {
+            const edgeweight w = Aux::Random::probability();
+            reference.addEdge(u, v, w);
+            G.addEdge(u, v, w);
+        }
+    }
+    G.removeNode(3);
+    reference.removeNode(3);
+    checkSorted();
+
+    ASSERT_EQ(G.numberOfEdges(), reference.numberOfEdges());
+    ASSERT_EQ(G.numberOfSelfLoops(), reference.numberOfSelfLoops());
+    for (node u = 0; u < n; ++u) {
+        for (node v = 0; v < n; ++v) {
+            ASSERT_EQ(G.hasEdge(u, v), reference.hasEdge(u, v));
+            if (reference.hasEdge(u, v)) {
+                EXPECT_EQ(G.edgeId(u, v), reference.edgeId(u, v));
+                EXPECT_EQ(G.weight(u, v), reference.weight(u, v));
+            }
+        }
+    }
+
+    G.removeSelfLoops();
+    checkSorted();
+
+    // Swapping targets gives up the order
+    node s1 = none, t1 = none;
+    G.forEdges([&](node u, node v) {
+        if (s1 == none && u != v) {
+            s1 = u;
+            t1 = v;
+        }
+    });
+    G.swapEdge(s1, t1, s1, t1);
+    EXPECT_FALSE(G.hasSortedAdjacency());
+}
+
+TEST_P(GraphGTest, testRemoveNodesAndEdges) {
+    constexpr node n = 80;
+
+    Aux::Random::setSeed(42, false);
+    Graph expected = createGraph(n, 6 * n);
+    expected.addEdge(5, 5, 0.5);
+    expected.addEdge(9, 9, 0.25);
+    expected.indexEdges();
+    Graph G = expected;
+
+    auto checkEqual = [&]() {
+        ASSERT_EQ(G.numberOfNodes(), expected.numberOfNodes());
+        ASSERT_EQ(G.numberOfEdges(), expected.numberOfEdges());
+        ASSERT_EQ(G.numberOfSelfLoops(), expected.numberOfSelfLoops());
+        for (node u = 0; u < n; ++u) {
+            ASSERT_EQ(G.hasNode(u), expected.hasNode(u));
+            if (!G.hasNode(u))
+                continue;
+            ASSERT_EQ(G.degree(u), expected.degree(u));
+            ASSERT_EQ(G.degreeIn(u), expected.degreeIn(u));
+            for (node v = 0; v < n; ++v) {
+                ASSERT_EQ(G.hasEdge(u, v), expected.hasEdge(u, v));
+                if (expected.hasEdge(u, v)) {
+                    EXPECT_EQ(G.edgeId(u, v), expected.edgeId(u, v));
+                    EXPECT_EQ(G.weight(u, v), expected.weight(u, v));
+                }
+            }
+        }
+    };
+
+    // Nodes with a self-loop, adjacent ones and a duplicate
+    const std::vector<node> nodes = {5, 7, 9, 10, 11, 12, 7};
+    G.removeNodes(nodes.begin(), nodes.end());
+    for (node u : {5, 7, 9, 10, 11, 12})
+        expected.removeNode(u);
+    checkEqual();
+
+    std::vector<std::pair<node, node>> edges;
+    expected.forEdges([&](node u, node v) {
+        if (edges.size() < expected.numberOfEdges() / 2 && Aux::Random::probability() < 0.5)
+            edges.emplace_back(u, v);
+    });
+    G.removeEdges(edges.begin(), edges.end());
+    for (const auto &e : edges)
+        expected.removeEdge(e.first, e.second);
+    checkEqual();
+
+    // A missing edge leaves the graph unchanged
+    std::vector<std::pair<node, node>> missing = {edges.front()};
+    G.forEdges([&](node u, node v) {
+        if (missing.size() < 3)
+            missing.emplace_back(u, v);
+    });
+    EXPECT_THROW(G.removeEdges(missing.begin(), missing.end()), std::runtime_error);
+    checkEqual();
+}
+
 TEST_P(GraphGTest, testEdgeIdsAfterRemove) {
     constexpr node n = 100;
 
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <networkit/auxiliary/Random.hpp>
+#include <networkit/centrality/CoreDecomposition.hpp>
+#include <networkit/community/PLM.hpp>
+#include <networkit/distance/BFS.hpp>
+#include <networkit/generators/ErdosRenyiGenerator.hpp>
+#include <networkit/graph/Graph.hpp>
+#include <networkit/graph/GraphTools.hpp>
+#include <networkit/graph/NodeRelabeling.hpp>
+
+namespace NetworKit {
+
+class NodeRelabelingGTest : public testing::TestWithParam<NodeRelabeling::Order> {
+protected:
+    NodeRelabeling relabel(const Graph &G) const {
+        if (GetParam() == NodeRelabeling::Order::COMMUNITY) {
+            PLM plm(G);
+            plm.run();
+            communities = plm.getPartition();
+            return NodeRelabeling(G, communities);
+        }
+        return NodeRelabeling(G, GetParam());
+    }
+
+    mutable Partition communities;
+};
+
+INSTANTIATE_TEST_SUITE_P(InstantiationName, NodeRelabelingGTest,
+                         testing::Values(NodeRelabeling::Order::BFS,
+                                         NodeRelabeling::Order::REVERSE_CUTHILL_MCKEE,
+                                         NodeRelabeling::Order::DEGREE,
+                                         NodeRelabeling::Order::DEGENERACY,
+                                         NodeRelabeling::Order::COMMUNITY));
+
+TEST_P(NodeRelabelingGTest, testPermutation) {
+    for (bool directed : {false, true}) {
+        if (directed && GetParam() == NodeRelabeling::Order::COMMUNITY)
+            continue; // PLM needs an undirected graph
+        Aux::Random::setSeed(42, false);
+        Graph G = ErdosRenyiGenerator(300, 0.02, directed).generate();
+        G.removeNode(3);
+        NodeRelabeling relabeling = relabel(G);
+        relabeling.run();
+
+        const auto &permutation = relabeling.getPermutation();
+        const auto &inverse = relabeling.getInversePermutation();
+        ASSERT_EQ(permutation.size(), G.upperNodeIdBound());
+        ASSERT_EQ(inverse.size(), G.numberOfNodes());
+        for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+            if (!G.hasNode(u)) {
+                EXPECT_EQ(permutation[u], none);
+                continue;
+            }
+            ASSERT_LT(permutation[u], G.numberOfNodes());
+            EXPECT_EQ(inverse[permutation[u]], u);
+        }
+    }
+}
+
+TEST_P(NodeRelabelingGTest, testRelabeledGraph) {
+    for (bool directed : {false, true}) {
+        if (directed && GetParam() == NodeRelabeling::Order::COMMUNITY)
+            continue;
+        // Weights and edge ids must be permuted along with the edges
+        Aux::Random::setSeed(42, false);
+        Graph G(ErdosRenyiGenerator(300, 0.02, directed).generate(), true, directed);
+        G.forEdges([&](node u, node v) { G.setWeight(u, v, Aux::Random::probability()); });
+        G.removeNode(3);
+        G.indexEdges();
+        NodeRelabeling relabeling = relabel(G);
+        relabeling.run();
+        const auto &permutation = relabeling.getPermutation();
+        const Graph H = relabeling.getRelabeledGraph();
+
+        EXPECT_EQ(H.numberOfNodes(), G.numberOfNodes());
+        EXPECT_EQ(H.upperNodeIdBound(), G.numberOfNodes());
+        EXPECT_EQ(H.numberOfEdges(), G.numberOfEdges());
+        EXPECT_EQ(H.isDirected(), G.isDirected());
+        EXPECT_TRUE(H.hasEdgeIds());
+        G.forNodes([&](node u) {
+            EXPECT_EQ(H.degreeOut(permutation[u]), G.degreeOut(u));
+            EXPECT_EQ(H.degreeIn(permutation[u]), G.degreeIn(u));
+        });
+        G.forEdges([&](node u, node v, edgeweight w, edgeid id) {
+            ASSERT_TRUE(H.hasEdge(permutation[u], permutation[v]));
+            EXPECT_EQ(H.weight(permutation[u], permutation[v]), w);
+            EXPECT_EQ(H.edgeId(permutation[u], permutation[v]), id);
+        });
+    }
+}
+
+TEST_P(NodeRelabelingGTest, testMapBack) {
+    Aux::Random::setSeed(42, false);
+    Graph G = ErdosRenyiGenerator(300, 0.02).generate();
+    G.removeNode(3);
+    NodeRelabeling relabeling = relabel(G);
+    relabeling.run();
+    const Graph H = relabeling.getRelabeledGraph();
+
+    const node source = 0;
+    BFS bfs(G, source);
+    bfs.run();
+    BFS bfsRelabeled(H, relabeling.getPermutation()[source]);
+    bfsRelabeled.run();
+
+    const auto distances = relabeling.mapBack(bfsRelabeled.getDistances(), -1.);
+    G.forNodes([&](node u) { EXPECT_EQ(distances[u], bfs.getDistances()[u]); });
+    EXPECT_EQ(distances[3], -1.);
+}
+
+TEST(NodeRelabelingOrderGTest, testReverseCuthillMcKeeBandwidth) {
+    // A path with shuffled node ids has bandwidth 1 after relabeling
+    constexpr count n = 100;
+    std::vector<node> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    Aux::Random::setSeed(42, false);
+    std::shuffle(ids.begin(), ids.end(), Aux::Random::getURNG());
+    Graph G(n);
+    for (index i = 1; i < n; ++i)
+        G.addEdge(ids[i - 1], ids[i]);
+
+    NodeRelabeling relabeling(G, NodeRelabeling::Order::REVERSE_CUTHILL_MCKEE);
+    relabeling.run();
+    relabeling.getRelabeledGraph().forEdges([](node u, node v) {
+        EXPECT_EQ(std::max(u, v) - std::min(u, v), node{1});
+    });
+}
+
+TEST(NodeRelabelingOrderGTest, testDegeneracy) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(300, 0.05).generate();
+    NodeRelabeling relabeling(G, NodeRelabeling::Order::DEGENERACY);
+    relabeling.run();
+    const auto &permutation = relabeling.getPermutation();
+
+    CoreDecomposition cores(G);
+    cores.run();
+
+    // Every node has at most degeneracy many neighbors after it
+    count maxLater = 0;
+    G.forNodes([&](node u) {
+        count later = 0;
+        G.forNeighborsOf(u, [&](node v) { later += permutation[v] > permutation[u]; });
+        maxLater = std::max(maxLater, later);
+    });
+    EXPECT_EQ(maxLater, cores.maxCoreNumber());
+}
+
+TEST(NodeRelabelingOrderGTest, testCommunitiesAreContiguous) {
+    Aux::Random::setSeed(42, false);
+    const Graph G = ErdosRenyiGenerator(300, 0.02).generate();
+    PLM plm(G);
+    plm.run();
+    const Partition communities = plm.getPartition();
+
+    NodeRelabeling relabeling(G, communities);
+    relabeling.run();
+    const auto &inverse = relabeling.getInversePermutation();
+
+    // Every community is one block of consecutive new ids
+    std::vector<bool> finished(communities.upperBound(), false);
+    for (index i = 1; i < inverse.size(); ++i) {
+        const index previous = communities[inverse[i - 1]];
+        const index current = communities[inverse[i]];
+        if (previous != current) {
+            finished[previous] = true;
+            EXPECT_FALSE(finished[current]);
+        }
+    }
+
+    EXPECT_THROW(NodeRelabeling(G, NodeRelabeling::Order::COMMUNITY), std::runtime_error);
+}
+
+} // namespace NetworKit
@@ -5,8 +5,13 @@
  *      Author: cls
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
+#include <numeric>
 #include <sstream>
+#include <type_traits>
+#include <omp.h>
 
 #include <networkit/auxiliary/Enforce.hpp>
 #include <networkit/auxiliary/Log.hpp>
@@ -16,10 +21,258 @@
 
 namespace NetworKit {
 
+namespace {
+
+// Weight of an edge read from a weighted file
+struct StoredWeight {
+    edgeweight weight;
+
+    edgeweight getWeight() const noexcept { return weight; }
+    void setWeight(edgeweight w) noexcept { weight = w; }
+};
+
+// Unweighted files store no weight; as an empty base it takes no space in the edges
+struct NoWeight {
+    edgeweight getWeight() const noexcept { return defaultEdgeWeight; }
+    void setWeight(edgeweight) noexcept {}
+};
+
+template <typename Weight>
+struct ParsedEdge : Weight {
+    node source;
+    node target;
+};
+
+// Entry of an adjacency array; position is that of the edge in the file
+template <typename Weight>
+struct HalfEdge : Weight {
+    node neighbor;
+    index position;
+};
+
+bool isLineEnding(char c) {
+    return c == '\n' || c == '\r';
+}
+
+const char *skipSeparators(const char *it, const char *end, char separator) {
+    while (it != end && (*it == ' ' || *it == separator))
+        ++it;
+    return it;
+}
+
+// Skips blank and comment lines, returns the first id of the next edge line or end
+const char *nextEdgeLine(const char *it, const char *end, char separator, char comment) {
+    while (true) {
+        it = skipSeparators(it, end, separator);
+        if (it == end)
+            return end;
+        if (isLineEnding(*it)) {
+            ++it;
+        } else if (*it == comment) {
+            while (it != end && !isLineEnding(*it))
+                ++it;
+        } else {
+            return it;
+        }
+    }
+}
+
+// Faster than strtol, as it reads unsigned decimal numbers only and needs no terminated string
+const char *parseId(const char *it, const char *end, node &id) {
+    const char *first = it;
+    id = 0;
+    while (it != end && *it >= '0' && *it <= '9') {
+        id = 10 * id + static_cast<node>(*it - '0');
+        ++it;
+    }
+    if (it == first)
+        throw std::runtime_error("Scanning node failed. The file may be corrupt.");
+    return it;
+}
+
+const char *parseWeight(const char *it, const char *end, char separator, edgeweight &weight) {
+    // strtod needs a terminated string, which the mapped file is not
+    char buffer[64];
+    size_t length = 0;
+    while (it != end && *it != ' ' && *it != separator && !isLineEnding(*it)
+           && length + 1 < sizeof(buffer))
+        buffer[length++] = *it++;
+    buffer[length] = '\0';
+
+    char *past;
+    weight = std::strtod(buffer, &past);
+    if (length == 0 || past != buffer + length)
+        throw std::runtime_error("Error in parsing file - looking for weight failed");
+    return it;
+}
+
+template <typename Weight>
+std::vector<ParsedEdge<Weight>> parseChunk(const char *it, const char *end, char separator,
+                                           char comment) {
+    constexpr bool weighted = std::is_same<Weight, StoredWeight>::value;
+    // Reserving for every line avoids the doubled capacity of growing the vector
+    std::vector<ParsedEdge<Weight>> edges;
+    edges.reserve(static_cast<count>(std::count(it, end, '\n')) + 1);
+    while ((it = nextEdgeLine(it, end, separator, comment)) != end) {
+        ParsedEdge<Weight> edge;
+        it = parseId(it, end, edge.source);
+        if (it == end)
+            throw std::runtime_error("Unexpected end of file");
+        if (!(*it == ' ' || *it == separator))
+            throw std::runtime_error("Error in parsing file - pointer is whitespace or separator");
+        it = parseId(skipSeparators(it, end, separator), end, edge.target);
+        it = skipSeparators(it, end, separator);
+        if (weighted) {
+            edgeweight weight;
+            it = skipSeparators(parseWeight(it, end, separator, weight), end, separator);
+            edge.setWeight(weight);
+        }
+        if (it != end && !isLineEnding(*it))
+            throw std::runtime_error("Error in parsing file - unexpected column");
+        edges.push_back(edge);
+    }
+    return edges;
+}
+
+// Keeps the first occurrence of each neighbor, in the order of the file
+template <typename Edge>
+Edge *removeRepeatedEdges(Edge *first, Edge *last) {
+    std::sort(first, last, [](const Edge &a, const Edge &b) {
+        return a.neighbor < b.neighbor || (a.neighbor == b.neighbor && a.position < b.position);
+    });
+    last = std::unique(first, last,
+                       [](const Edge &a, const Edge &b) { return a.neighbor == b.neighbor; });
+    std::sort(first, last, [](const Edge &a, const Edge &b) { return a.position < b.position; });
+    return last;
+}
+
+// Parses the chunks between consecutive bounds in parallel and builds the graph from them
+template <typename Weight>
+Graph readChunks(const std::vector<const char *> &bounds, char separator, char comment,
+                 node firstNode, bool directed) {
+    const count chunks = bounds.size() - 1;
+    std::vector<std::vector<ParsedEdge<Weight>>> edges(chunks);
+    std::vector<std::string> errors(chunks);
+#pragma omp parallel for schedule(dynamic)
+    for (omp_index c = 0; c < static_cast<omp_index>(chunks); ++c) {
+        try {
+            edges[c] = parseChunk<Weight>(bounds[c], bounds[c + 1], separator, comment);
+        } catch (const std::runtime_error &e) {
+            errors[c] = e.what();
+        }
+    }
+    for (const auto &error : errors)
+        if (!error.empty())
+            throw std::runtime_error(error);
+
+    std::vector<index> chunkOffsets(chunks + 1, 0);
+    node minId = none, maxId = 0;
+    for (index c = 0; c < chunks; ++c) {
+        chunkOffsets[c + 1] = chunkOffsets[c] + edges[c].size();
+        for (const auto &edge : edges[c]) {
+            minId = std::min({minId, edge.source, edge.target});
+            maxId = std::max({maxId, edge.source, edge.target});
+        }
+    }
+    if (chunkOffsets.back() > 0 && minId < firstNode)
+        throw std::runtime_error("Error in parsing file - node id smaller than the first node");
+    const count n = chunkOffsets.back() > 0 ? maxId - firstNode + 1 : 0;
+
+    // Count the degrees, then place the half edges by the prefix sums of the degrees
+    std::vector<index> outOffsets(n + 1, 0), inOffsets(directed ? n + 1 : 0, 0);
+    auto forEdges = [&](bool release, auto handle) {
+#pragma omp parallel for schedule(dynamic)
+        for (omp_index c = 0; c < static_cast<omp_index>(chunks); ++c) {
+            for (index i = 0; i < edges[c].size(); ++i) {
+                const auto &edge = edges[c][i];
+                handle(edge.source - firstNode, edge.target - firstNode, edge,
+                       chunkOffsets[c] + i);
+            }
+            if (release)
+                std::vector<ParsedEdge<Weight>>().swap(edges[c]);
+        }
+    };
+
+    forEdges(false, [&](node u, node v, const Weight &, index) {
+#pragma omp atomic
+        ++outOffsets[u + 1];
+        if (directed) {
+#pragma omp atomic
+            ++inOffsets[v + 1];
+        } else if (u != v) {
+#pragma omp atomic
+            ++outOffsets[v + 1];
+        }
+    });
+    std::partial_sum(outOffsets.begin(), outOffsets.end(), outOffsets.begin());
+    std::partial_sum(inOffsets.begin(), inOffsets.end(), inOffsets.begin());
+
+    std::vector<HalfEdge<Weight>> outEdges(outOffsets.back());
+    std::vector<HalfEdge<Weight>> inEdges(directed ? inOffsets.back() : 0);
+    {
+        auto nextOut = outOffsets;
+        auto nextIn = inOffsets;
+        auto place = [](std::vector<HalfEdge<Weight>> &halfEdges, index &next, node neighbor,
+                        const Weight &weight, index position) {
+            index i;
+#pragma omp atomic capture
+            i = next++;
+            static_cast<Weight &>(halfEdges[i]) = weight;
+            halfEdges[i].neighbor = neighbor;
+            halfEdges[i].position = position;
+        };
+        // Each chunk is released once its edges are placed
+        forEdges(true, [&](node u, node v, const Weight &weight, index position) {
+            place(outEdges, nextOut[u], v, weight, position);
+            if (directed)
+                place(inEdges, nextIn[v], u, weight, position);
+            else if (u != v)
+                place(outEdges, nextOut[v], u, weight, position);
+        });
+    }
+
+    // Repeated edges are ignored like in read(), the order of the adjacency arrays is the same
+    Graph G(n, std::is_same<Weight, StoredWeight>::value, directed);
+    count halfEdges = 0;
+    count selfLoops = 0;
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+ : halfEdges, selfLoops)
+    for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+        auto *outFirst = outEdges.data() + outOffsets[u];
+        auto *outLast = removeRepeatedEdges(outFirst, outEdges.data() + outOffsets[u + 1]);
+        halfEdges += static_cast<count>(outLast - outFirst);
+
+        if (directed) {
+            auto *inFirst = inEdges.data() + inOffsets[u];
+            auto *inLast = removeRepeatedEdges(inFirst, inEdges.data() + inOffsets[u + 1]);
+            G.preallocateDirected(u, outLast - outFirst, inLast - inFirst);
+            for (const auto *e = outFirst; e != outLast; ++e) {
+                G.addPartialOutEdge(unsafe, u, e->neighbor, e->getWeight());
+                selfLoops += e->neighbor == static_cast<node>(u);
+            }
+            for (const auto *e = inFirst; e != inLast; ++e)
+                G.addPartialInEdge(unsafe, u, e->neighbor, e->getWeight());
+        } else {
+            G.preallocateUndirected(u, outLast - outFirst);
+            for (const auto *e = outFirst; e != outLast; ++e) {
+                G.addPartialEdge(unsafe, u, e->neighbor, e->getWeight());
+                selfLoops += e->neighbor == static_cast<node>(u);
+            }
+        }
+    }
+
+    // Self-loops of undirected graphs are stored once
+    G.setEdgeCount(unsafe, directed ? halfEdges : (halfEdges + selfLoops) / 2);
+    G.setNumberOfSelfLoops(unsafe, selfLoops);
+    assert(G.checkConsistency());
+    return G;
+}
+
+} // namespace
+
 EdgeListReader::EdgeListReader(char separator, node firstNode, const std::string &commentPrefix,
-                               bool continuous, bool directed)
+                               bool continuous, bool directed, bool parallel)
     : separator(separator), commentPrefix(commentPrefix), firstNode(firstNode),
-      continuous(continuous), mapNodeIds(), directed(directed) {
+      continuous(continuous), mapNodeIds(), directed(directed), parallel(parallel) {
     if (!continuous && firstNode != 0) {
         // firstNode not being 0 in the continuous = false case leads to a segmentation fault
         WARN("firstNode set to 0 since continuous is false");
@@ -39,6 +292,8 @@ Graph EdgeListReader::read(const std::string &path) {
     MemoryMappedFile mmfile(path);
     auto it = mmfile.cbegin();
     auto end = mmfile.cend();
+    if (parallel && continuous)
+        return readParallel(it, end);
 
     bool weighted = false;
     bool checkedWeighted = false;
@@ -165,4 +420,34 @@ Graph EdgeListReader::read(const std::string &path) {
     return graph;
 }
 
+Graph EdgeListReader::readParallel(const char *begin, const char *end) const {
+    const char comment = commentPrefix[0];
+
+    // Like read(), the graph is weighted iff the first edge line has a third column
+    bool weighted = false;
+    const char *firstLine = nextEdgeLine(begin, end, separator, comment);
+    if (firstLine != end) {
+        node id;
+        const char *it = skipSeparators(parseId(firstLine, end, id), end, separator);
+        it = skipSeparators(parseId(it, end, id), end, separator);
+        weighted = it != end && !isLineEnding(*it);
+    }
+
+    // Split the file into chunks of whole lines
+    const auto size = static_cast<count>(end - begin);
+    const count chunks = std::max<count>(
+        1, std::min<count>(4 * static_cast<count>(omp_get_max_threads()), size >> 16));
+    std::vector<const char *> bounds(chunks + 1, end);
+    bounds[0] = begin;
+    for (index c = 1; c < chunks; ++c) {
+        const char *it = std::max(bounds[c - 1], begin + size / chunks * c);
+        while (it != end && *it != '\n')
+            ++it;
+        bounds[c] = it == end ? end : it + 1;
+    }
+
+    return weighted ? readChunks<StoredWeight>(bounds, separator, comment, firstNode, directed)
+                    : readChunks<NoWeight>(bounds, separator, comment, firstNode, directed);
+}
+
 } /* namespace NetworKit */
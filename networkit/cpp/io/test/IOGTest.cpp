@@ -419,6 +419,44 @@ TEST_F(IOGTest, testEdgeListReader) {
     EXPECT_EQ(1, G5.weight(2,3));
 }
 
+TEST_F(IOGTest, testParallelEdgeListReader) {
+    auto expectSameGraph = [](const Graph &G, const Graph &H) {
+        ASSERT_EQ(G.upperNodeIdBound(), H.upperNodeIdBound());
+        ASSERT_EQ(G.numberOfEdges(), H.numberOfEdges());
+        EXPECT_EQ(G.numberOfSelfLoops(), H.numberOfSelfLoops());
+        EXPECT_EQ(G.isWeighted(), H.isWeighted());
+        EXPECT_EQ(G.isDirected(), H.isDirected());
+        G.forNodes([&](node u) {
+            std::vector<std::pair<node, edgeweight>> expected, actual;
+            G.forNeighborsOf(u, [&](node v, edgeweight ew) { expected.emplace_back(v, ew); });
+            H.forNeighborsOf(u, [&](node v, edgeweight ew) { actual.emplace_back(v, ew); });
+            EXPECT_EQ(actual, expected);
+            expected.clear();
+            actual.clear();
+            G.forInNeighborsOf(u, [&](node v, edgeweight ew) { expected.emplace_back(v, ew); });
+            H.forInNeighborsOf(u, [&](node v, edgeweight ew) { actual.emplace_back(v, ew); });
+            EXPECT_EQ(actual, expected);
+        });
+    };
+
+    // input/repeated_edges*.edgelist have repeated and reversed edges, self-loops, blank lines,
+    // comments and \r\n line endings
+    for (bool directed : {false, true}) {
+        for (const std::string path :
+             {"input/repeated_edges.edgelist", "input/repeated_edges_weighted.edgelist",
+              "input/spaceseparated.edgelist"}) {
+            const Graph G = EdgeListReader(' ', 1, "#", true, directed).read(path);
+            const Graph H = EdgeListReader(' ', 1, "#", true, directed, true).read(path);
+            expectSameGraph(G, H);
+        }
+
+        const Graph G = EdgeListReader('\t', 0, "#", true, directed).read("input/wiki-Vote.txt");
+        const Graph H =
+            EdgeListReader('\t', 0, "#", true, directed, true).read("input/wiki-Vote.txt");
+        expectSameGraph(G, H);
+    }
+}
+
 TEST_F(IOGTest, testEdgeListPartitionReader) {
     EdgeListPartitionReader reader(1);
 
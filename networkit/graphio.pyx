@@ -235,13 +235,13 @@ cdef extern from "<networkit/io/EdgeListReader.hpp>":
 
 	cdef cppclass _EdgeListReader "NetworKit::EdgeListReader"(_GraphReader):
 		_EdgeListReader() except +
-		_EdgeListReader(char separator, node firstNode, string commentPrefix, bool_t continuous, bool_t directed)
+		_EdgeListReader(char separator, node firstNode, string commentPrefix, bool_t continuous, bool_t directed, bool_t parallel)
 		map[string,node] getNodeMap() except +
 
 cdef class EdgeListReader(GraphReader):
 	""" Reads a graph from various text-based edge list formats.
 
-	EdgeListReader(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False)
+	EdgeListReader(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False, parallel=False)
 
 	A line has to contain two or three entries separated with the separator symbol (one ASCII character).
 	If at least one line contains three entries, the generated graph will be weighted and
@@ -275,12 +275,14 @@ cdef class EdgeListReader(GraphReader):
 		File uses continuous node ids.
 	directed : bool
 		Treat input file as a directed graph.
+	parallel : bool
+		Parse the file in chunks on all threads. Only used with continuous node ids.
 	"""
-	def __cinit__(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False):
+	def __cinit__(self, separator, firstNode, commentPrefix="#", continuous=True, directed=False, parallel=False):
 		if len(separator) != 1 or ord(separator[0]) > 255:
 			raise RuntimeError("separator has to be exactly one ascii character");
 
-		self._this = new _EdgeListReader(stdstring(separator)[0], firstNode, stdstring(commentPrefix), continuous, directed)
+		self._this = new _EdgeListReader(stdstring(separator)[0], firstNode, stdstring(commentPrefix), continuous, directed, parallel)
 
 	def getNodeMap(self):
 		""" Returns mapping of non-continuous files.